@@ -0,0 +1,77 @@
+# Compile-time and binary-size benchmark for sol2 binding styles. Generates
+# one translation unit per style and type count (scripts/gen_bindings.py),
+# records compile time and peak compiler memory per object through a
+# compiler launcher, and links everything into luatypetest_bindings, which
+# times registering each variant in a fresh state. On Linux each variant is
+# also linked on its own into a shared module (bindings/<variant>.so), whose
+# dynamic relocations are what loading those bindings costs. Report with
+# scripts/compile_report.py <build-dir>.
+
+option(LUATYPETEST_COMPILE_BENCH "Build the binding-style compile-time benchmark" OFF)
+set(LUATYPETEST_BINDING_STYLES lambdas c_call member_pointers raw_c_api CACHE STRING "Binding styles to generate")
+set(LUATYPETEST_BINDING_COUNTS 4 50 200 CACHE STRING "Numbers of types to register per style")
+
+if(NOT LUATYPETEST_COMPILE_BENCH)
+    return()
+endif()
+
+find_package(Python3 REQUIRED COMPONENTS Interpreter)
+set(_generator "${CMAKE_CURRENT_SOURCE_DIR}/scripts/gen_bindings.py")
+set(_launcher "${CMAKE_CURRENT_SOURCE_DIR}/scripts/measure_compile.py")
+set(_log "${CMAKE_BINARY_DIR}/compile_times.csv")
+
+set(_variants)
+set(_objects)
+set(_modules)
+foreach(_style IN LISTS LUATYPETEST_BINDING_STYLES)
+    foreach(_count IN LISTS LUATYPETEST_BINDING_COUNTS)
+        set(_name bindings_${_style}_${_count})
+        set(_source "${CMAKE_BINARY_DIR}/bindings/${_name}.cpp")
+        add_custom_command(OUTPUT "${_source}"
+            COMMAND Python3::Interpreter "${_generator}" tu ${_style} ${_count} "${_source}"
+            DEPENDS "${_generator}"
+            VERBATIM)
+
+        add_library(${_name} OBJECT "${_source}")
+        target_link_libraries(${_name} PRIVATE luatypetest::lua sol2::sol2)
+        luatypetest_configure_sol2(${_name})
+        luatypetest_optimize(${_name})
+        set_target_properties(${_name} PROPERTIES
+            POSITION_INDEPENDENT_CODE ON
+            CXX_COMPILER_LAUNCHER "${Python3_EXECUTABLE};${_launcher};${_log}")
+
+        # Lua stays undefined in the module, as it would in a binding library
+        # loaded by the host, so its calls count as symbol relocations
+        if(CMAKE_SYSTEM_NAME STREQUAL "Linux")
+            add_library(${_name}_module MODULE $<TARGET_OBJECTS:${_name}>)
+            set_target_properties(${_name}_module PROPERTIES
+                OUTPUT_NAME ${_name}
+                PREFIX ""
+                LIBRARY_OUTPUT_DIRECTORY "${CMAKE_BINARY_DIR}/bindings")
+            luatypetest_optimize(${_name}_module)
+            list(APPEND _modules ${_name}_module)
+        endif()
+
+        list(APPEND _variants ${_style}_${_count})
+        list(APPEND _objects $<TARGET_OBJECTS:${_name}>)
+    endforeach()
+endforeach()
+
+set(_main "${CMAKE_BINARY_DIR}/bindings/bindings_main.cpp")
+add_custom_command(OUTPUT "${_main}"
+    COMMAND Python3::Interpreter "${_generator}" main "${_main}" ${_variants}
+    DEPENDS "${_generator}"
+    VERBATIM)
+
+add_executable(luatypetest_bindings "${_main}" ${_objects})
+target_link_libraries(luatypetest_bindings PRIVATE
+    luatypetest::lua
+    benchmark::benchmark
+    benchmark::benchmark_main
+    sol2::sol2)
+luatypetest_configure_sol2(luatypetest_bindings)
+luatypetest_optimize(luatypetest_bindings)
+if(_modules)
+    # Building the benchmark builds everything compile_report.py reads
+    add_dependencies(luatypetest_bindings ${_modules})
+endif()
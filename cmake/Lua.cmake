@@ -0,0 +1,154 @@
+# Provides luatypetest::lua: from vcpkg (default), LuaJIT from vcpkg, or PUC
+# Lua built from the official source tarball in one of several
+# configurations. Building from source lets the benchmark measure how the Lua
+# build itself affects sol2: error handling (longjmp vs C++ exceptions),
+# number types, API checks, the interpreter's dispatch loop and the Lua
+# version (5.1 to 5.4).
+
+option(LUATYPETEST_LUA_FROM_SOURCE "Build Lua from source instead of using the vcpkg package" OFF)
+set(LUATYPETEST_LUA_VERSION "5.4.8" CACHE STRING "Lua version to build when LUATYPETEST_LUA_FROM_SOURCE=ON")
+set_property(CACHE LUATYPETEST_LUA_VERSION PROPERTY STRINGS 5.1.5 5.2.4 5.3.6 5.4.8)
+option(LUATYPETEST_LUA_AS_CXX "Compile Lua as C++ so errors are C++ exceptions instead of longjmp" OFF)
+option(LUATYPETEST_LUA_32BITS "Build Lua with 32-bit integers and floats (LUA_32BITS)" OFF)
+option(LUATYPETEST_LUA_APICHECK "Build Lua with LUA_USE_APICHECK" OFF)
+option(LUATYPETEST_LUA_COMPUTED_GOTO "Build the interpreter loop with computed goto where supported (LUA_USE_JUMPTABLE)" ON)
+option(LUATYPETEST_LUAJIT "Use LuaJIT from vcpkg (needs VCPKG_MANIFEST_FEATURES=luajit)" OFF)
+option(LUATYPETEST_LUAJIT_JIT "Leave LuaJIT's JIT compiler on; OFF runs the interpreter only" ON)
+
+if(NOT LUATYPETEST_LUA_FROM_SOURCE)
+    foreach(_variant AS_CXX 32BITS APICHECK)
+        if(LUATYPETEST_LUA_${_variant})
+            message(FATAL_ERROR "LUATYPETEST_LUA_${_variant} requires LUATYPETEST_LUA_FROM_SOURCE=ON")
+        endif()
+    endforeach()
+    if(NOT LUATYPETEST_LUA_COMPUTED_GOTO)
+        message(FATAL_ERROR "LUATYPETEST_LUA_COMPUTED_GOTO=OFF requires LUATYPETEST_LUA_FROM_SOURCE=ON")
+    endif()
+elseif(LUATYPETEST_LUAJIT)
+    message(FATAL_ERROR "LUATYPETEST_LUAJIT and LUATYPETEST_LUA_FROM_SOURCE are mutually exclusive")
+endif()
+if(NOT LUATYPETEST_LUAJIT_JIT AND NOT LUATYPETEST_LUAJIT)
+    message(FATAL_ERROR "LUATYPETEST_LUAJIT_JIT=OFF requires LUATYPETEST_LUAJIT=ON")
+endif()
+
+if(LUATYPETEST_LUAJIT)
+    find_path(LUAJIT_INCLUDE_DIR luajit.h PATH_SUFFIXES luajit luajit-2.1 REQUIRED)
+    find_library(LUAJIT_LIBRARY NAMES luajit-5.1 luajit lua51 REQUIRED)
+    add_library(luatypetest_lua INTERFACE)
+    target_link_libraries(luatypetest_lua INTERFACE ${LUAJIT_LIBRARY} ${CMAKE_DL_LIBS})
+    target_include_directories(luatypetest_lua INTERFACE ${LUAJIT_INCLUDE_DIR})
+    target_compile_definitions(luatypetest_lua INTERFACE SOL_LUAJIT=1)
+    if(NOT LUATYPETEST_LUAJIT_JIT)
+        target_compile_definitions(luatypetest_lua INTERFACE LUATYPETEST_LUAJIT_INTERPRETER)
+    endif()
+    add_library(luatypetest::lua ALIAS luatypetest_lua)
+    message(STATUS "LuaJIT from ${LUAJIT_LIBRARY}: JIT=${LUATYPETEST_LUAJIT_JIT}")
+    return()
+endif()
+
+if(NOT LUATYPETEST_LUA_FROM_SOURCE)
+    find_package(Lua REQUIRED)
+    add_library(luatypetest_lua INTERFACE)
+    target_link_libraries(luatypetest_lua INTERFACE ${LUA_LIBRARIES})
+    target_include_directories(luatypetest_lua INTERFACE ${LUA_INCLUDE_DIR})
+    add_library(luatypetest::lua ALIAS luatypetest_lua)
+    return()
+endif()
+
+if(LUATYPETEST_LUA_32BITS AND LUATYPETEST_LUA_VERSION VERSION_LESS 5.3)
+    message(FATAL_ERROR "LUATYPETEST_LUA_32BITS requires Lua 5.3 or newer")
+endif()
+# Only 5.4's interpreter loop has the jump table that LUA_USE_JUMPTABLE switches
+if(NOT LUATYPETEST_LUA_COMPUTED_GOTO AND LUATYPETEST_LUA_VERSION VERSION_LESS 5.4)
+    message(FATAL_ERROR "LUATYPETEST_LUA_COMPUTED_GOTO=OFF requires Lua 5.4 or newer")
+endif()
+
+include(FetchContent)
+FetchContent_Declare(lua
+    URL https://www.lua.org/ftp/lua-${LUATYPETEST_LUA_VERSION}.tar.gz
+    DOWNLOAD_EXTRACT_TIMESTAMP TRUE)
+FetchContent_MakeAvailable(lua)
+
+# The build uses a copy of src/ so luaconf.h can be edited below without
+# touching the downloaded sources. The whole directory is copied because lua.h
+# includes "luaconf.h" from its own directory before any include path.
+set(_lua_src "${CMAKE_CURRENT_BINARY_DIR}/lua-${LUATYPETEST_LUA_VERSION}-src")
+file(COPY "${lua_SOURCE_DIR}/src/" DESTINATION "${_lua_src}" PATTERN "luaconf.h" EXCLUDE)
+# 5.1 ships lua.hpp in etc/. Without it sol2 would find another Lua's lua.hpp
+# on the include path and compile against that version's headers.
+if(NOT EXISTS "${_lua_src}/lua.hpp")
+    file(COPY "${lua_SOURCE_DIR}/etc/lua.hpp" DESTINATION "${_lua_src}")
+endif()
+
+# Everything except the standalone interpreter and compiler (print.c is
+# luac's disassembler in 5.1)
+file(GLOB _lua_sources "${_lua_src}/*.c")
+list(FILTER _lua_sources EXCLUDE REGEX "/(lua|luac|onelua|print)\\.c$")
+
+if(LUATYPETEST_LUA_AS_CXX)
+    set_source_files_properties(${_lua_sources} PROPERTIES LANGUAGE CXX)
+else()
+    enable_language(C)
+endif()
+
+add_library(luatypetest_lua STATIC ${_lua_sources})
+add_library(luatypetest::lua ALIAS luatypetest_lua)
+target_include_directories(luatypetest_lua PUBLIC "${_lua_src}")
+
+if(WIN32)
+    # Static library, so no LUA_BUILD_AS_DLL
+elseif(APPLE)
+    target_compile_definitions(luatypetest_lua PRIVATE LUA_USE_MACOSX)
+else()
+    target_compile_definitions(luatypetest_lua PRIVATE LUA_USE_LINUX)
+    target_link_libraries(luatypetest_lua PUBLIC m ${CMAKE_DL_LIBS})
+endif()
+
+# Checked against LUA_VERSION_NUM in bench_common.hpp, so headers from any
+# other Lua on the include path fail the build instead of mismatching the library
+string(REGEX MATCH "^([0-9]+)\\.([0-9]+)" _ "${LUATYPETEST_LUA_VERSION}")
+math(EXPR _lua_version_num "${CMAKE_MATCH_1} * 100 + ${CMAKE_MATCH_2}")
+target_compile_definitions(luatypetest_lua PUBLIC LUATYPETEST_LUA_VERSION_NUM=${_lua_version_num})
+
+if(LUATYPETEST_LUA_AS_CXX)
+    # sol2 must not wrap the Lua headers in extern "C" and may let exceptions
+    # cross Lua frames
+    target_compile_definitions(luatypetest_lua PUBLIC SOL_USING_CXX_LUA=1)
+endif()
+
+# Lua 5.4 defines LUA_32BITS unconditionally in luaconf.h, so it is switched
+# in the copy; older versions only test whether it is defined. The copy is
+# only rewritten when its content changes, so reconfiguring does not rebuild.
+file(READ "${lua_SOURCE_DIR}/src/luaconf.h" _luaconf)
+if(_luaconf MATCHES "#define LUA_32BITS[ \t]+[01]")
+    if(LUATYPETEST_LUA_32BITS)
+        set(_bits 1)
+    else()
+        set(_bits 0)
+    endif()
+    string(REGEX REPLACE "#define LUA_32BITS[ \t]+[01]" "#define LUA_32BITS\t${_bits}" _luaconf "${_luaconf}")
+elseif(LUATYPETEST_LUA_32BITS)
+    target_compile_definitions(luatypetest_lua PUBLIC LUA_32BITS)
+endif()
+set(_luaconf_copy "")
+if(EXISTS "${_lua_src}/luaconf.h")
+    file(READ "${_lua_src}/luaconf.h" _luaconf_copy)
+endif()
+if(NOT _luaconf_copy STREQUAL _luaconf)
+    file(WRITE "${_lua_src}/luaconf.h" "${_luaconf}")
+endif()
+
+if(LUATYPETEST_LUA_APICHECK)
+    target_compile_definitions(luatypetest_lua PRIVATE LUA_USE_APICHECK)
+endif()
+
+# Lua already enables the jump table on GCC and Clang, and MSVC cannot build it
+if(NOT LUATYPETEST_LUA_COMPUTED_GOTO)
+    target_compile_definitions(luatypetest_lua PRIVATE LUA_USE_JUMPTABLE=0)
+endif()
+
+luatypetest_optimize(luatypetest_lua)
+
+message(STATUS "Lua ${LUATYPETEST_LUA_VERSION} from source: as C++=${LUATYPETEST_LUA_AS_CXX}, "
+    "32 bits=${LUATYPETEST_LUA_32BITS}, apicheck=${LUATYPETEST_LUA_APICHECK}, "
+    "computed goto=${LUATYPETEST_LUA_COMPUTED_GOTO}")
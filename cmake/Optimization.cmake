@@ -0,0 +1,74 @@
+# Optimisation knobs used by the Linux benchmark matrix (see CMakePresets.json
+# and scripts/bench_matrix.sh). All of them default to off so the MSVC and
+# clang-cl presets build exactly as before.
+
+option(LUATYPETEST_NATIVE "Compile with -march=native" OFF)
+option(LUATYPETEST_LTO "Enable link-time optimisation" OFF)
+set(LUATYPETEST_PGO "OFF" CACHE STRING "Profile-guided optimisation phase: OFF, GENERATE or USE")
+set_property(CACHE LUATYPETEST_PGO PROPERTY STRINGS OFF GENERATE USE)
+set(LUATYPETEST_PGO_DIR "${CMAKE_BINARY_DIR}/pgo" CACHE PATH "Directory holding PGO profiles")
+
+if(LUATYPETEST_LTO)
+    include(CheckIPOSupported)
+    check_ipo_supported(RESULT _lto_supported OUTPUT _lto_error LANGUAGES CXX)
+    if(NOT _lto_supported)
+        message(FATAL_ERROR "LUATYPETEST_LTO=ON but LTO is not supported: ${_lto_error}")
+    endif()
+endif()
+
+if(NOT LUATYPETEST_PGO STREQUAL "OFF" AND MSVC)
+    message(FATAL_ERROR "LUATYPETEST_PGO is only implemented for GCC and Clang")
+endif()
+
+# Applies the selected optimisation options to a target. Called for the
+# benchmark executable and for any library built from source in this project,
+# so LTO and PGO see both sides of the Lua/C++ boundary.
+function(luatypetest_optimize target)
+    if(LUATYPETEST_NATIVE)
+        target_compile_options(${target} PRIVATE -march=native)
+    endif()
+
+    if(LUATYPETEST_LTO)
+        set_property(TARGET ${target} PROPERTY INTERPROCEDURAL_OPTIMIZATION ON)
+    endif()
+
+    if(LUATYPETEST_PGO STREQUAL "GENERATE")
+        target_compile_options(${target} PRIVATE "-fprofile-generate=${LUATYPETEST_PGO_DIR}")
+        target_link_options(${target} PRIVATE "-fprofile-generate=${LUATYPETEST_PGO_DIR}")
+    elseif(LUATYPETEST_PGO STREQUAL "USE")
+        if(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+            # Clang reads a single merged profile (see luatypetest_pgo_train)
+            set(_profile "${LUATYPETEST_PGO_DIR}/default.profdata")
+            target_compile_options(${target} PRIVATE "-fprofile-use=${_profile}" -Wno-profile-instr-unprofiled)
+            target_link_options(${target} PRIVATE "-fprofile-use=${_profile}")
+        else()
+            # GCC reads one .gcda per object from the profile directory
+            target_compile_options(${target} PRIVATE "-fprofile-use=${LUATYPETEST_PGO_DIR}"
+                -fprofile-partial-training -Wno-missing-profile)
+            target_link_options(${target} PRIVATE "-fprofile-use=${LUATYPETEST_PGO_DIR}")
+        endif()
+    endif()
+endfunction()
+
+# Adds a target that trains the instrumented executable on the do_work
+# scripts and, for Clang, merges the raw profiles into default.profdata.
+function(luatypetest_add_pgo_training target)
+    if(NOT LUATYPETEST_PGO STREQUAL "GENERATE")
+        return()
+    endif()
+
+    set(_commands
+        COMMAND ${CMAKE_COMMAND} -E rm -rf "${LUATYPETEST_PGO_DIR}"
+        COMMAND ${CMAKE_COMMAND} -E make_directory "${LUATYPETEST_PGO_DIR}"
+        COMMAND $<TARGET_FILE:${target}> "--benchmark_filter=^BM_(Usertypes|Tables)/" --benchmark_min_time=0.2s)
+    if(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+        find_program(LLVM_PROFDATA NAMES llvm-profdata REQUIRED)
+        list(APPEND _commands
+            COMMAND sh -c "\"${LLVM_PROFDATA}\" merge -o \"${LUATYPETEST_PGO_DIR}/default.profdata\" \"${LUATYPETEST_PGO_DIR}\"/*.profraw")
+    endif()
+
+    add_custom_target(${target}_pgo_train ${_commands}
+        DEPENDS ${target}
+        COMMENT "Training ${target} for PGO on the do_work scripts"
+        VERBATIM)
+endfunction()
@@ -0,0 +1,42 @@
+# sol2 configuration macros, selectable per build so the cost of the safety
+# checks and error-handling modes can be measured. The defaults match the
+# original benchmark: all safeties off, exceptions on.
+
+option(LUATYPETEST_SOL_SAFETIES "Build with SOL_ALL_SAFETIES_ON=1" OFF)
+option(LUATYPETEST_SOL_NO_EXCEPTIONS "Build with SOL_NO_EXCEPTIONS=1" OFF)
+option(LUATYPETEST_SOL_SAFE_PROPAGATION "Build with SOL_EXCEPTIONS_SAFE_PROPAGATION=1 (Lua compiled as C++ only)" OFF)
+option(LUATYPETEST_SOL_STRINGS_ARE_NUMBERS "Build with SOL_STRINGS_ARE_NUMBERS=1" OFF)
+option(LUATYPETEST_SOL_EXCEPTION_HANDLER "Install a custom exception handler instead of sol2's default one" OFF)
+set(LUATYPETEST_SOL_DEFINES "" CACHE STRING "Extra sol2 configuration macros, e.g. SOL_SAFE_USERTYPE=1;SOL_SAFE_FUNCTION_CALLS=1")
+
+if(LUATYPETEST_SOL_SAFE_PROPAGATION AND NOT LUATYPETEST_LUA_AS_CXX)
+    message(FATAL_ERROR "LUATYPETEST_SOL_SAFE_PROPAGATION requires LUATYPETEST_LUA_AS_CXX=ON")
+endif()
+if(LUATYPETEST_SOL_NO_EXCEPTIONS AND LUATYPETEST_SOL_EXCEPTION_HANDLER)
+    message(FATAL_ERROR "LUATYPETEST_SOL_EXCEPTION_HANDLER has no effect with LUATYPETEST_SOL_NO_EXCEPTIONS=ON")
+endif()
+
+function(luatypetest_configure_sol2 target)
+    if(LUATYPETEST_SOL_SAFETIES)
+        target_compile_definitions(${target} PRIVATE SOL_ALL_SAFETIES_ON=1)
+    else()
+        # Disable sol2 safety checks for fair perf comparison
+        target_compile_definitions(${target} PRIVATE SOL_ALL_SAFETIES_ON=0)
+    endif()
+
+    if(LUATYPETEST_SOL_NO_EXCEPTIONS)
+        target_compile_definitions(${target} PRIVATE SOL_NO_EXCEPTIONS=1)
+    endif()
+    if(LUATYPETEST_SOL_SAFE_PROPAGATION)
+        target_compile_definitions(${target} PRIVATE SOL_EXCEPTIONS_SAFE_PROPAGATION=1)
+    endif()
+    if(LUATYPETEST_SOL_STRINGS_ARE_NUMBERS)
+        target_compile_definitions(${target} PRIVATE SOL_STRINGS_ARE_NUMBERS=1)
+    endif()
+    if(LUATYPETEST_SOL_EXCEPTION_HANDLER)
+        target_compile_definitions(${target} PRIVATE LUATYPETEST_SOL_EXCEPTION_HANDLER)
+    endif()
+    if(LUATYPETEST_SOL_DEFINES)
+        target_compile_definitions(${target} PRIVATE ${LUATYPETEST_SOL_DEFINES})
+    endif()
+endfunction()
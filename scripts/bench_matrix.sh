@@ -0,0 +1,45 @@
+#!/usr/bin/env bash
+# Builds and runs luatypetest once per line of a matrix file, then prints a
+# markdown summary of ns/item and speedups.
+#
+#   scripts/bench_matrix.sh [matrix-file] [extra benchmark arguments...]
+#
+# Builds go to build-matrix/<name>, JSON results to build-matrix/results/<name>.json.
+# SUMMARIZE_ARGS is passed to scripts/summarize.py, e.g. "--ratio BM_Usertypes:BM_Tables".
+set -euo pipefail
+
+root="$(cd "$(dirname "$0")/.." && pwd)"
+matrix="${1:-$root/scripts/matrix/compilers.txt}"
+shift || true
+bench_args=("$@")
+
+out="$root/build-matrix"
+mkdir -p "$out/results"
+results=()
+
+while read -r name preset extra; do
+    [[ -z "$name" || "$name" == \#* ]] && continue
+    build="$out/$name"
+    read -r -a extra_args <<< "${extra:-}"
+    echo "=== $name ($preset ${extra:-})"
+
+    cmake -S "$root" -B "$build" --preset "$preset" "${extra_args[@]}" > /dev/null
+    cmake --build "$build"
+
+    # PGO builds are trained and rebuilt in the same directory, because GCC
+    # keys its profiles on the object file paths
+    if grep -q '^LUATYPETEST_PGO:STRING=GENERATE$' "$build/CMakeCache.txt"; then
+        cmake --build "$build" --target luatypetest_pgo_train
+        cmake "$build" -DLUATYPETEST_PGO=USE > /dev/null
+        cmake --build "$build"
+    fi
+
+    "$build/luatypetest" \
+        --benchmark_out="$out/results/$name.json" \
+        --benchmark_out_format=json \
+        "${bench_args[@]}"
+    results+=("$out/results/$name.json")
+done < "$matrix"
+
+read -r -a summarize_args <<< "${SUMMARIZE_ARGS:-}"
+python3 "$root/scripts/summarize.py" "${summarize_args[@]}" "${results[@]}"
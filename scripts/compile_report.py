@@ -0,0 +1,80 @@
+#!/usr/bin/env python3
+"""Reports the compile-time benchmark of a build with LUATYPETEST_COMPILE_BENCH=ON.
+
+    scripts/compile_report.py <build-dir>
+
+For each binding style and type count: compile time and peak compiler
+memory (from compile_times.csv), object size, the dynamic relocations of the
+variant linked as a shared module and the time to register the types in a
+fresh state (from luatypetest_bindings).
+
+The relocations are read from bindings/<variant>.so (Linux only) with
+readelf --use-dynamic, i.e. .rela.dyn and .rela.plt: what the dynamic loader
+applies when the bindings are loaded. Symbolic ones also need a symbol
+lookup; the rest are R_*_RELATIVE.
+"""
+import csv
+import json
+import re
+import shutil
+import subprocess
+import sys
+from pathlib import Path
+
+VARIANT = re.compile(r"bindings_([a-z_]+?)_(\d+)\.cpp\.o(bj)?$")
+
+
+def dynamic_relocations(module):
+    """(total, symbolic) dynamic relocations of a shared object, or None"""
+    if not module.exists() or not shutil.which("readelf"):
+        return None
+    out = subprocess.run(["readelf", "-rW", "--use-dynamic", str(module)],
+                         capture_output=True, text=True).stdout
+    relocs = [line.split()[2] for line in out.splitlines() if re.match(r"^[0-9a-f]{8,} ", line)]
+    return len(relocs), sum(1 for kind in relocs if not kind.endswith("_RELATIVE"))
+
+
+def registration_times(build):
+    exe = build / "luatypetest_bindings"
+    if not exe.exists():
+        return {}
+    out = subprocess.run([str(exe), "--benchmark_format=json"], capture_output=True, text=True, check=True).stdout
+    benchmarks = json.loads(out)["benchmarks"]
+    empty = next(b["cpu_time"] for b in benchmarks if b["name"] == "BM_EmptyState")
+    return {b["name"].split("/", 1)[1]: b["cpu_time"] - empty
+            for b in benchmarks if b["name"].startswith("BM_Register/")}
+
+
+def main(argv):
+    if len(argv) != 1:
+        print(__doc__.strip(), file=sys.stderr)
+        return 1
+    build = Path(argv[0])
+
+    compiles = {}
+    with open(build / "compile_times.csv") as f:
+        for obj, seconds, peak_kb in csv.reader(f):
+            compiles[obj] = (float(seconds), int(peak_kb))  # last build wins
+    startup = registration_times(build)
+
+    rows = []
+    for obj, (seconds, peak_kb) in compiles.items():
+        match = VARIANT.search(obj)
+        if not match or not Path(obj).exists():
+            continue
+        style, count = match.group(1), int(match.group(2))
+        relocs = dynamic_relocations(build / "bindings" / f"bindings_{style}_{count}.so")
+        register_ns = startup.get(f"{style}_{count}")
+        rows.append((style, count, seconds, peak_kb / 1024, Path(obj).stat().st_size / 1024, relocs, register_ns))
+
+    print("| Style | Types | Compile (s) | Peak memory (MiB) | Object (KiB) | Dynamic relocations | Symbolic | Register (µs) |")
+    print("|---|---|---|---|---|---|---|---|")
+    for style, count, seconds, peak_mb, size_kb, relocs, register_ns in sorted(rows):
+        print(f"| {style} | {count} | {seconds:.2f} | {peak_mb:.0f} | {size_kb:,.0f} | "
+              f"{relocs[0] if relocs else '–'} | {relocs[1] if relocs else '–'} | "
+              f"{register_ns / 1000 if register_ns is not None else float('nan'):.1f} |")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,230 @@
+#!/usr/bin/env python3
+"""Generates the binding translation units for the compile-time benchmark.
+
+    scripts/gen_bindings.py tu <style> <count> <out.cpp>
+    scripts/gen_bindings.py main <out.cpp> <style>_<count>...
+
+`tu` writes one translation unit registering <count> Vector2-like types in
+one binding style, mirroring register_usertypes() in src/bench.cpp:
+
+    lambdas          every field, method and operator is a lambda
+    c_call           member-pointer fields; methods and operators through
+                     sol::c_call
+    member_pointers  &T::x, &T::len2 and member operators
+    raw_c_api        luaL_newmetatable with hand-written __index/__newindex
+
+`main` writes the benchmark that times registering each variant in a fresh
+state, which is the startup cost the bindings add. Before timing, each
+variant must pass a smoke check on every type: construct, read, write, read
+back, len2 and +.
+
+A data-member sol::c_call cannot serve as a field: as a property it gets the
+raw __index/__newindex stack, key included, and picks get or set from the
+argument count. The c_call style therefore differs from member_pointers in
+its methods and operators only.
+"""
+import sys
+from pathlib import Path
+
+STYLES = ("lambdas", "c_call", "member_pointers", "raw_c_api")
+
+STRUCT = """\
+struct {t} {{
+    float x, y;
+    {t}(float x, float y) : x(x), y(y) {{}}
+    float len2() const {{ return x * x + y * y; }}
+    {t} add(const {t}& o) const {{ return {t}{{ x + o.x, y + o.y }}; }}
+}};
+"""
+
+LAMBDAS = """\
+    lua.new_usertype<{t}>("{t}",
+        sol::call_constructor, sol::factories([](float x, float y) {{ return {t}{{ x, y }}; }}),
+        "x", sol::property([](const {t}& v) {{ return v.x; }}, []({t}& v, float x) {{ v.x = x; }}),
+        "y", sol::property([](const {t}& v) {{ return v.y; }}, []({t}& v, float y) {{ v.y = y; }}),
+        "len2", [](const {t}& v) {{ return v.x * v.x + v.y * v.y; }},
+        sol::meta_function::addition, [](const {t}& a, const {t}& b) {{ return {t}{{ a.x + b.x, a.y + b.y }}; }}
+    );
+"""
+
+C_CALL = """\
+    lua.new_usertype<{t}>("{t}",
+        sol::call_constructor, sol::constructors<{t}(float, float)>(),
+        "x", &{t}::x,
+        "y", &{t}::y,
+        "len2", sol::c_call<decltype(&{t}::len2), &{t}::len2>,
+        sol::meta_function::addition, sol::c_call<decltype(&{t}::add), &{t}::add>
+    );
+"""
+
+MEMBER_POINTERS = """\
+    lua.new_usertype<{t}>("{t}",
+        sol::call_constructor, sol::constructors<{t}(float, float)>(),
+        "x", &{t}::x,
+        "y", &{t}::y,
+        "len2", &{t}::len2,
+        sol::meta_function::addition, &{t}::add
+    );
+"""
+
+RAW_FUNCTIONS = """\
+static int {t}_new(lua_State* L) {{
+    float x = static_cast<float>(luaL_checknumber(L, 1));
+    float y = static_cast<float>(luaL_checknumber(L, 2));
+    new (lua_newuserdata(L, sizeof({t}))) {t}{{ x, y }};
+    luaL_getmetatable(L, "{t}");
+    lua_setmetatable(L, -2);
+    return 1;
+}}
+static int {t}_index(lua_State* L) {{
+    auto* v = static_cast<{t}*>(luaL_checkudata(L, 1, "{t}"));
+    const char* key = luaL_checkstring(L, 2);
+    switch (key[0]) {{
+    case 'x': lua_pushnumber(L, v->x); return 1;
+    case 'y': lua_pushnumber(L, v->y); return 1;
+    case 'l': lua_pushcfunction(L, {t}_len2); return 1;
+    default: return 0;
+    }}
+}}
+static int {t}_newindex(lua_State* L) {{
+    auto* v = static_cast<{t}*>(luaL_checkudata(L, 1, "{t}"));
+    const char* key = luaL_checkstring(L, 2);
+    float value = static_cast<float>(luaL_checknumber(L, 3));
+    if (key[0] == 'x') v->x = value;
+    else if (key[0] == 'y') v->y = value;
+    return 0;
+}}
+static int {t}_add(lua_State* L) {{
+    auto* a = static_cast<{t}*>(luaL_checkudata(L, 1, "{t}"));
+    auto* b = static_cast<{t}*>(luaL_checkudata(L, 2, "{t}"));
+    new (lua_newuserdata(L, sizeof({t}))) {t}{{ a->add(*b) }};
+    luaL_getmetatable(L, "{t}");
+    lua_setmetatable(L, -2);
+    return 1;
+}}
+"""
+
+RAW_LEN2 = """\
+static int {t}_len2(lua_State* L) {{
+    auto* v = static_cast<{t}*>(luaL_checkudata(L, 1, "{t}"));
+    lua_pushnumber(L, v->len2());
+    return 1;
+}}
+"""
+
+RAW_REGISTER = """\
+    luaL_newmetatable(L, "{t}");
+    lua_pushcfunction(L, {t}_index);    lua_setfield(L, -2, "__index");
+    lua_pushcfunction(L, {t}_newindex); lua_setfield(L, -2, "__newindex");
+    lua_pushcfunction(L, {t}_add);      lua_setfield(L, -2, "__add");
+    lua_pop(L, 1);
+    lua_register(L, "{t}", {t}_new);
+"""
+
+
+def generate_tu(style, count):
+    ns = f"bindings_{style}_{count}"
+    types = [f"T{i}" for i in range(count)]
+    out = ["// Generated by scripts/gen_bindings.py; do not edit.",
+           "#include <sol/sol.hpp>",
+           "#include <new>",
+           "",
+           f"namespace {ns} {{",
+           ""]
+    out += [STRUCT.format(t=t) for t in types]
+    if style == "raw_c_api":
+        for t in types:
+            out.append(RAW_LEN2.format(t=t))
+            out.append(RAW_FUNCTIONS.format(t=t))
+    out.append("} // namespace " + ns)
+    out.append("")
+    out.append(f"void register_{ns}(sol::state& lua) {{")
+    out.append(f"    using namespace {ns};")
+    if style == "raw_c_api":
+        out.append("    lua_State* L = lua.lua_state();")
+    template = {"lambdas": LAMBDAS, "c_call": C_CALL,
+                "member_pointers": MEMBER_POINTERS, "raw_c_api": RAW_REGISTER}[style]
+    out += [template.format(t=t) for t in types]
+    out.append("}")
+    return "\n".join(out) + "\n"
+
+
+def generate_main(variants):
+    out = ["// Generated by scripts/gen_bindings.py; do not edit.",
+           "#include <benchmark/benchmark.h>",
+           "#include <sol/sol.hpp>",
+           ""]
+    out += [f"void register_bindings_{v}(sol::state& lua);" for v in variants]
+    out.append("""
+// Cost of a fresh state with nothing registered, to subtract from the rest
+static void BM_EmptyState(benchmark::State& state) {
+    for (auto _ : state) {
+        sol::state lua;
+        benchmark::DoNotOptimize(lua.lua_state());
+    }
+}
+BENCHMARK(BM_EmptyState);
+
+// Every registered type T0..T<count-1> must construct, read, write and read
+// back its fields and call len2 and +; a broken binding is never timed
+static const char* const SMOKE_SCRIPT = R"lua(
+local count = ...
+for i = 0, count - 1 do
+    local T = _G["T" .. i]
+    local v = T(1, 2)
+    if v.x ~= 1 or v.y ~= 2 then return false end
+    v.x = 3
+    if v.x ~= 3 or v.y ~= 2 or v:len2() ~= 13 or (v + v).x ~= 6 then return false end
+end
+return true
+)lua";
+
+static bool smoke_check(void (*register_bindings)(sol::state&), int count) {
+    sol::state lua;
+    lua.open_libraries(sol::lib::base);
+    register_bindings(lua);
+    sol::load_result chunk = lua.load(SMOKE_SCRIPT);
+    if (!chunk.valid()) {
+        return false;
+    }
+    sol::protected_function check = chunk;
+    sol::protected_function_result result = check(count);
+    return result.valid() && result.get<bool>();
+}
+
+static void BM_Register(benchmark::State& state, void (*register_bindings)(sol::state&), int count) {
+    if (!smoke_check(register_bindings, count)) {
+        state.SkipWithError("binding smoke check failed");
+        return;
+    }
+    for (auto _ : state) {
+        sol::state lua;
+        register_bindings(lua);
+        benchmark::DoNotOptimize(lua.lua_state());
+    }
+}""")
+    out += [f"BENCHMARK_CAPTURE(BM_Register, {v}, &register_bindings_{v}, {v.rsplit('_', 1)[1]});" for v in variants]
+    return "\n".join(out) + "\n"
+
+
+def write_if_changed(path, text):
+    path = Path(path)
+    if path.exists() and path.read_text() == text:
+        return
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_text(text)
+
+
+def main(argv):
+    if len(argv) == 4 and argv[0] == "tu" and argv[1] in STYLES:
+        write_if_changed(argv[3], generate_tu(argv[1], int(argv[2])))
+        return 0
+    if len(argv) >= 2 and argv[0] == "main":
+        write_if_changed(argv[1], generate_main(argv[2:]))
+        return 0
+    print(__doc__.strip(), file=sys.stderr)
+    return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
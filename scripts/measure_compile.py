@@ -0,0 +1,37 @@
+#!/usr/bin/env python3
+"""Compiler launcher that records wall time and peak memory per object.
+
+    measure_compile.py <log.csv> <compiler> <args...>
+
+Used as CXX_COMPILER_LAUNCHER by the compile-time benchmark. Appends
+"object,seconds,peak_rss_kb" to <log.csv> and passes the compiler's exit
+code through.
+"""
+import os
+import resource
+import subprocess
+import sys
+import time
+
+
+def main(argv):
+    if len(argv) < 2:
+        print(__doc__.strip(), file=sys.stderr)
+        return 1
+    log, command = argv[0], argv[1:]
+
+    start = time.perf_counter()
+    result = subprocess.run(command)
+    seconds = time.perf_counter() - start
+    # Includes grandchildren such as cc1plus, once the driver has waited for them
+    peak_kb = resource.getrusage(resource.RUSAGE_CHILDREN).ru_maxrss
+
+    if result.returncode == 0 and "-o" in command:
+        obj = os.path.abspath(command[command.index("-o") + 1])
+        with open(log, "a") as f:
+            f.write(f"{obj},{seconds:.3f},{peak_kb}\n")
+    return result.returncode
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
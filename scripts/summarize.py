@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+"""Summarises Google Benchmark JSON files from several builds as markdown.
+
+    scripts/summarize.py [--ratio BM_Usertypes:BM_Tables] results/gcc-O2.json results/gcc-O3.json ...
+
+Each file is one build, named after the file stem. The first file is the
+baseline: the second table shows every build's speedup relative to it.
+--ratio A:B adds a table of A/x over B/x for every argument x, per build.
+"""
+import argparse
+import json
+import sys
+from pathlib import Path
+
+
+def ns_per_item(bench):
+    if "items_per_second" in bench:
+        return 1e9 / bench["items_per_second"]
+    return None
+
+
+def load(path):
+    with open(path) as f:
+        data = json.load(f)
+    rows = {}
+    for bench in data["benchmarks"]:
+        # Skip aggregate rows (mean/median/stddev) when run with repetitions
+        if bench.get("run_type", "iteration") != "iteration":
+            continue
+        value = ns_per_item(bench)
+        if value is not None:
+            rows[bench["name"]] = value
+    return rows
+
+
+def table(header, rows):
+    lines = ["| " + " | ".join(header) + " |",
+             "|" + "|".join("---" for _ in header) + "|"]
+    lines += ["| " + " | ".join(row) + " |" for row in rows]
+    return "\n".join(lines)
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(usage=__doc__.strip().splitlines()[2].strip())
+    parser.add_argument("--ratio", action="append", default=[], metavar="A:B")
+    parser.add_argument("paths", nargs="+")
+    args = parser.parse_args(argv)
+    paths = args.paths
+
+    builds = [Path(p).stem for p in paths]
+    results = [load(p) for p in paths]
+    names = list(dict.fromkeys(name for r in results for name in r))
+
+    def cell(value, fmt):
+        return fmt.format(value) if value is not None else "–"
+
+    print("### ns/item\n")
+    print(table(["Benchmark"] + builds,
+                [[name] + [cell(r.get(name), "{:,.0f}") for r in results] for name in names]))
+
+    baseline = results[0]
+    print(f"\n### Speedup vs {builds[0]}\n")
+    rows = []
+    for name in names:
+        base = baseline.get(name)
+        row = [name]
+        for r in results:
+            value = r.get(name)
+            row.append(cell(base / value if base and value else None, "{:.2f}×"))
+        rows.append(row)
+    print(table(["Benchmark"] + builds, rows))
+
+    for ratio in args.ratio:
+        num, den = ratio.split(":")
+        print(f"\n### {num} / {den}\n")
+        rows = []
+        for name in names:
+            if not name.startswith(num + "/"):
+                continue
+            suffix = name[len(num):]
+            row = [suffix.lstrip("/")]
+            for r in results:
+                a, b = r.get(name), r.get(den + suffix)
+                row.append(cell(a / b if a and b else None, "{:.2f}×"))
+            rows.append(row)
+        print(table(["Args"] + builds, rows))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -1,30 +1,33 @@
-#include <benchmark/benchmark.h>
-#include <sol/sol.hpp>
-
-// ── Struct definitions ────────────────────────────────────────────────────────
-
-struct Vector2 {
-    float x, y;
-    Vector2(float x, float y) : x(x), y(y) {}
-};
-struct Vector3 {
-    float x, y, z;
-    Vector3(float x, float y, float z) : x(x), y(y), z(z) {}
-};
-struct RectF {
-    float x, y, w, h;
-    RectF(float x, float y, float w, float h) : x(x), y(y), w(w), h(h) {}
-};
-struct Point {
-    int x, y;
-    Point(int x, int y) : x(x), y(y) {}
-};
+#include "bench_common.hpp"
 
-// ── Usertype registration ─────────────────────────────────────────────────────
+#ifdef LUATYPETEST_LUAJIT_INTERPRETER
+#include <luajit.h>
+#endif
+
+// ── State setup ───────────────────────────────────────────────────────────────
+
+#ifdef LUATYPETEST_SOL_EXCEPTION_HANDLER
+// Minimal replacement for sol2's default handler: pushes the message without
+// building a std::string first.
+static int exception_handler(lua_State* L, sol::optional<const std::exception&>, sol::string_view description) {
+    lua_pushlstring(L, description.data(), description.size());
+    return 1;
+}
+#endif
 
-static void register_usertypes(sol::state& lua) {
+void open_state(sol::state& lua) {
     lua.open_libraries(sol::lib::base);
+#ifdef LUATYPETEST_LUAJIT_INTERPRETER
+    luaJIT_setmode(lua.lua_state(), 0, LUAJIT_MODE_ENGINE | LUAJIT_MODE_OFF);
+#endif
+#ifdef LUATYPETEST_SOL_EXCEPTION_HANDLER
+    lua.set_exception_handler(&exception_handler);
+#endif
+}
+
+// ── Usertype registration ─────────────────────────────────────────────────────
 
+void register_usertypes(sol::state& lua) {
     lua.new_usertype<Vector2>("Vector2",
         sol::call_constructor, sol::constructors<Vector2(float, float)>(),
         "x", &Vector2::x,
@@ -63,7 +66,7 @@ static void register_usertypes(sol::state& lua) {
 
 // ── Lua scripts ───────────────────────────────────────────────────────────────
 
-static constexpr const char* USERTYPE_SCRIPT = R"lua(
+const char* const USERTYPE_SCRIPT = R"lua(
 function do_work(n)
     local sum = 0.0
     for i = 1, n do
@@ -135,6 +138,7 @@ end
 
 static void BM_Usertypes(benchmark::State& state) {
     sol::state lua;
+    open_state(lua);
     register_usertypes(lua);
     lua.script(USERTYPE_SCRIPT);
     sol::function do_work = lua["do_work"];
@@ -149,7 +153,7 @@ BENCHMARK(BM_Usertypes)->Arg(100)->Arg(1000)->Arg(10000);
 
 static void BM_Tables(benchmark::State& state) {
     sol::state lua;
-    lua.open_libraries(sol::lib::base);
+    open_state(lua);
     lua.script(TABLE_SCRIPT);
     sol::function do_work = lua["do_work"];
     const auto n = state.range(0);
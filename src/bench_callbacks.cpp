@@ -0,0 +1,180 @@
+#include "bench_common.hpp"
+
+#include <vector>
+
+// ── Lua scripts ───────────────────────────────────────────────────────────────
+
+// Callbacks the host invokes once per entity. Each touches its arguments so
+// the push is not wasted; on_update_batch runs the same body over an array.
+static constexpr const char* CALLBACK_SCRIPT = R"lua(
+local sum = 0.0
+
+function on_update(id, pos)
+    sum = sum + pos.x
+end
+
+function on_update_id(id)
+    sum = sum + id
+end
+
+function on_update_xyz(id, x, y, z)
+    sum = sum + x
+end
+
+function on_update_batch(positions, n)
+    for i = 1, n do
+        sum = sum + positions[i].x
+    end
+end
+
+function total()
+    return sum
+end
+)lua";
+
+// ── Call loops ────────────────────────────────────────────────────────────────
+
+// Each loop makes positions.size() calls per benchmark iteration, passing the
+// entity index and a pointer to its position unless the name says otherwise.
+using CallbackLoop = void (*)(benchmark::State&, sol::state&, std::vector<Vector3>&);
+
+// sol::function is unsafe_function unless the build turns sol2's safeties on
+static void call_function(benchmark::State& state, sol::state& lua, std::vector<Vector3>& positions) {
+    sol::function on_update = lua["on_update"];
+    const int n = static_cast<int>(positions.size());
+    for (auto _ : state) {
+        for (int i = 0; i < n; ++i) {
+            on_update(i, &positions[i]);
+        }
+    }
+}
+
+static void call_protected_function(benchmark::State& state, sol::state& lua, std::vector<Vector3>& positions) {
+    sol::protected_function on_update = lua["on_update"];
+    const int n = static_cast<int>(positions.size());
+    for (auto _ : state) {
+        for (int i = 0; i < n; ++i) {
+            auto result = on_update(i, &positions[i]);
+            if (!result.valid()) {
+                state.SkipWithError("on_update raised an error");
+                return;
+            }
+        }
+    }
+}
+
+static void call_unsafe_function(benchmark::State& state, sol::state& lua, std::vector<Vector3>& positions) {
+    sol::unsafe_function on_update = lua["on_update"];
+    const int n = static_cast<int>(positions.size());
+    for (auto _ : state) {
+        for (int i = 0; i < n; ++i) {
+            on_update(i, &positions[i]);
+        }
+    }
+}
+
+// The callback held by a registry reference, called with the plain C API
+static void call_raw_pcall(benchmark::State& state, sol::state& lua, std::vector<Vector3>& positions) {
+    lua_State* L = lua.lua_state();
+    lua_getglobal(L, "on_update");
+    const int ref = luaL_ref(L, LUA_REGISTRYINDEX);
+    const int n = static_cast<int>(positions.size());
+    for (auto _ : state) {
+        for (int i = 0; i < n; ++i) {
+            lua_rawgeti(L, LUA_REGISTRYINDEX, ref);
+            lua_pushinteger(L, i);
+            sol::stack::push(L, &positions[i]);
+            if (lua_pcall(L, 2, 0, 0) != LUA_OK) {
+                state.SkipWithError(lua_tostring(L, -1));
+                lua_pop(L, 1);
+                luaL_unref(L, LUA_REGISTRYINDEX, ref);
+                return;
+            }
+        }
+    }
+    luaL_unref(L, LUA_REGISTRYINDEX, ref);
+}
+
+// One call per iteration with a fresh Lua array of position pointers
+static void call_batch_table(benchmark::State& state, sol::state& lua, std::vector<Vector3>& positions) {
+    sol::unsafe_function on_update_batch = lua["on_update_batch"];
+    const int n = static_cast<int>(positions.size());
+    for (auto _ : state) {
+        sol::table batch = lua.create_table(n, 0);
+        for (int i = 0; i < n; ++i) {
+            batch.raw_set(i + 1, &positions[i]);
+        }
+        on_update_batch(batch, n);
+    }
+}
+
+// One call per iteration with the std::vector itself as a container userdata
+static void call_batch_container(benchmark::State& state, sol::state& lua, std::vector<Vector3>& positions) {
+    sol::unsafe_function on_update_batch = lua["on_update_batch"];
+    const int n = static_cast<int>(positions.size());
+    for (auto _ : state) {
+        on_update_batch(&positions, n);
+    }
+}
+
+// Argument-push cost, all through unsafe_function
+
+static void args_id(benchmark::State& state, sol::state& lua, std::vector<Vector3>& positions) {
+    sol::unsafe_function on_update = lua["on_update_id"];
+    const int n = static_cast<int>(positions.size());
+    for (auto _ : state) {
+        for (int i = 0; i < n; ++i) {
+            on_update(i);
+        }
+    }
+}
+
+static void args_numbers(benchmark::State& state, sol::state& lua, std::vector<Vector3>& positions) {
+    sol::unsafe_function on_update = lua["on_update_xyz"];
+    const int n = static_cast<int>(positions.size());
+    for (auto _ : state) {
+        for (int i = 0; i < n; ++i) {
+            const Vector3& p = positions[i];
+            on_update(i, p.x, p.y, p.z);
+        }
+    }
+}
+
+// A copy of the position in a new userdata per call
+static void args_value(benchmark::State& state, sol::state& lua, std::vector<Vector3>& positions) {
+    sol::unsafe_function on_update = lua["on_update"];
+    const int n = static_cast<int>(positions.size());
+    for (auto _ : state) {
+        for (int i = 0; i < n; ++i) {
+            on_update(i, positions[i]);
+        }
+    }
+}
+
+// ── Benchmarks ────────────────────────────────────────────────────────────────
+
+static void BM_Callback(benchmark::State& state, CallbackLoop loop) {
+    std::vector<Vector3> positions;
+    positions.reserve(static_cast<std::size_t>(state.range(0)));
+    for (int i = 0; i < state.range(0); ++i) {
+        positions.emplace_back(float(i), 0.0f, 0.0f);
+    }
+
+    sol::state lua;
+    open_state(lua);
+    register_usertypes(lua);
+    lua.script(CALLBACK_SCRIPT);
+    loop(state, lua, positions);
+    double total = lua["total"]();
+    benchmark::DoNotOptimize(total);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_CAPTURE(BM_Callback, function, &call_function)->Arg(1000)->Arg(1000000);
+BENCHMARK_CAPTURE(BM_Callback, protected_function, &call_protected_function)->Arg(1000)->Arg(1000000);
+BENCHMARK_CAPTURE(BM_Callback, unsafe_function, &call_unsafe_function)->Arg(1000)->Arg(1000000);
+BENCHMARK_CAPTURE(BM_Callback, raw_pcall, &call_raw_pcall)->Arg(1000)->Arg(1000000);
+BENCHMARK_CAPTURE(BM_Callback, batch_table, &call_batch_table)->Arg(1000)->Arg(1000000);
+BENCHMARK_CAPTURE(BM_Callback, batch_container, &call_batch_container)->Arg(1000)->Arg(1000000);
+BENCHMARK_CAPTURE(BM_Callback, args_id, &args_id)->Arg(1000)->Arg(1000000);
+BENCHMARK_CAPTURE(BM_Callback, args_numbers, &args_numbers)->Arg(1000)->Arg(1000000);
+BENCHMARK_CAPTURE(BM_Callback, args_value, &args_value)->Arg(1000)->Arg(1000000);
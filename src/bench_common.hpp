@@ -0,0 +1,44 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <sol/sol.hpp>
+
+#include "geometry.hpp"
+
+// Set when Lua is built from source (cmake/Lua.cmake)
+#if defined(LUATYPETEST_LUA_VERSION_NUM) && LUATYPETEST_LUA_VERSION_NUM != LUA_VERSION_NUM
+#error "Lua headers do not match the Lua version built from source"
+#endif
+
+// Opens the base library and applies the build's state options (LuaJIT mode,
+// exception handler). Every benchmark state starts here.
+void open_state(sol::state& lua);
+
+// Registers Vector2, Vector3, RectF and Point as the BM_Usertypes benchmark
+// sees them.
+void register_usertypes(sol::state& lua);
+
+// Adds the dot, cross, length, length_sq, normalize, lerp and distance
+// methods to register_usertypes' Vector2 and Vector3 (src/bench_methods.cpp).
+void register_vector_methods(sol::state& lua);
+
+// Adds __eq, __lt, __le, __unm, __tostring, __len and __concat to all four
+// register_usertypes types (src/bench_metamethods.cpp).
+void register_metamethods(sol::state& lua);
+
+// BM_Usertypes' do_work(n). Runs against any registration that provides the
+// Vector2, Vector3, RectF and Point constructors, x/y/z/w/h fields and the
+// vector + - * / operators.
+extern const char* const USERTYPE_SCRIPT;
+
+// Calls the global Lua function `name` with the benchmark argument once per
+// iteration; the argument is the number of inner-loop items.
+inline void run_lua_function(benchmark::State& state, sol::state& lua, const char* name) {
+    sol::function fn = lua[name];
+    const auto n = state.range(0);
+    for (auto _ : state) {
+        double result = fn(n);
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
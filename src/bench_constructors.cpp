@@ -0,0 +1,113 @@
+#include "bench_common.hpp"
+
+// ── Constructor surfaces ──────────────────────────────────────────────────────
+
+static Vector2 make_vector2(float x, float y) {
+    return Vector2{ x, y };
+}
+
+// Plain lua_CFunction: reads the arguments itself and only uses sol2 to push
+// the userdata, so the result has the same metatable as every other Vector2.
+static int vec2_raw(lua_State* L) {
+    float x = static_cast<float>(lua_tonumber(L, 1));
+    float y = static_cast<float>(lua_tonumber(L, 2));
+    return sol::stack::push(L, Vector2{ x, y });
+}
+
+static void register_constructor_usertypes(sol::state& lua) {
+    lua.new_usertype<Vector2>("Vector2",
+        sol::call_constructor, sol::constructors<Vector2(float, float)>(),
+        "new",  sol::constructors<Vector2(float, float)>(),
+        "make", sol::factories([](float x, float y) { return Vector2{ x, y }; }),
+        "cnew", sol::c_call<decltype(&make_vector2), &make_vector2>,
+        "x", &Vector2::x,
+        "y", &Vector2::y
+    );
+    lua.set_function("vec2", &vec2_raw);
+    lua.set_function("vec2_bound", &make_vector2);
+}
+
+// ── Lua scripts ───────────────────────────────────────────────────────────────
+
+// One construction per item; reading x keeps the result alive.
+static constexpr const char* CONSTRUCTOR_SCRIPT = R"lua(
+function ctor_call(n)
+    local sum = 0.0
+    for i = 1, n do
+        local v = Vector2(i, i+1)
+        sum = sum + v.x
+    end
+    return sum
+end
+
+function ctor_new(n)
+    local sum = 0.0
+    for i = 1, n do
+        local v = Vector2.new(i, i+1)
+        sum = sum + v.x
+    end
+    return sum
+end
+
+function ctor_factory(n)
+    local sum = 0.0
+    for i = 1, n do
+        local v = Vector2.make(i, i+1)
+        sum = sum + v.x
+    end
+    return sum
+end
+
+function ctor_c_call(n)
+    local sum = 0.0
+    for i = 1, n do
+        local v = Vector2.cnew(i, i+1)
+        sum = sum + v.x
+    end
+    return sum
+end
+
+function ctor_raw(n)
+    local sum = 0.0
+    for i = 1, n do
+        local v = vec2(i, i+1)
+        sum = sum + v.x
+    end
+    return sum
+end
+
+function ctor_bound(n)
+    local sum = 0.0
+    for i = 1, n do
+        local v = vec2_bound(i, i+1)
+        sum = sum + v.x
+    end
+    return sum
+end
+
+function ctor_table(n)
+    local sum = 0.0
+    for i = 1, n do
+        local v = {x=i, y=i+1}
+        sum = sum + v.x
+    end
+    return sum
+end
+)lua";
+
+// ── Benchmarks ────────────────────────────────────────────────────────────────
+
+static void BM_Construct(benchmark::State& state, const char* function) {
+    sol::state lua;
+    open_state(lua);
+    register_constructor_usertypes(lua);
+    lua.script(CONSTRUCTOR_SCRIPT);
+    run_lua_function(state, lua, function);
+}
+BENCHMARK_CAPTURE(BM_Construct, call_constructor, "ctor_call")->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Construct, new, "ctor_new")->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Construct, factories, "ctor_factory")->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Construct, c_call, "ctor_c_call")->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Construct, raw_c_function, "ctor_raw")->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Construct, bound_function, "ctor_bound")->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Construct, lua_table, "ctor_table")->Arg(100)->Arg(1000)->Arg(10000);
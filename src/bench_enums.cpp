@@ -0,0 +1,292 @@
+#include "bench_common.hpp"
+
+#include <string>
+#include <string_view>
+
+// ── Bindings ──────────────────────────────────────────────────────────────────
+
+// sol2 pushes and reads enums as integers, so the fields cost the same in
+// every mode except `string`; what changes is how scripts name the values.
+enum class EnumBinding {
+    read_only, // sol::new_enum: Anchor.center goes through the proxy's __index
+    writable,  // sol::new_enum<false>: a plain table, one hash lookup
+    integer,   // no tables; scripts use integer literals
+    string,    // AnchoredRectF.anchor is the value's name as a Lua string
+};
+
+static constexpr const char* ANCHOR_NAMES[] = {
+    "top_left", "top", "top_right", "left", "center", "right", "bottom_left", "bottom", "bottom_right",
+};
+
+static Anchor anchor_from_name(std::string_view name) {
+    for (int i = 0; i < 9; ++i) {
+        if (name == ANCHOR_NAMES[i]) {
+            return static_cast<Anchor>(i);
+        }
+    }
+    return Anchor::top_left;
+}
+
+template <bool ReadOnly>
+static void register_enum_tables(sol::state& lua) {
+    lua.new_enum<ReadOnly>("Anchor",
+        "top_left",     Anchor::top_left,
+        "top",          Anchor::top,
+        "top_right",    Anchor::top_right,
+        "left",         Anchor::left,
+        "center",       Anchor::center,
+        "right",        Anchor::right,
+        "bottom_left",  Anchor::bottom_left,
+        "bottom",       Anchor::bottom,
+        "bottom_right", Anchor::bottom_right);
+    lua.new_enum<ReadOnly>("Collision",
+        "none",    Collision::none,
+        "world",   Collision::world,
+        "player",  Collision::player,
+        "enemy",   Collision::enemy,
+        "trigger", Collision::trigger);
+}
+
+static void register_enum_usertypes(sol::state& lua, EnumBinding binding) {
+    switch (binding) {
+    case EnumBinding::read_only:
+        register_enum_tables<true>(lua);
+        break;
+    case EnumBinding::writable:
+        register_enum_tables<false>(lua);
+        break;
+    case EnumBinding::integer:
+    case EnumBinding::string:
+        break;
+    }
+
+    auto rect = lua.new_usertype<AnchoredRectF>("AnchoredRectF",
+        sol::call_constructor, sol::constructors<AnchoredRectF(float, float, float, float, Anchor)>(),
+        "x", &AnchoredRectF::x,
+        "y", &AnchoredRectF::y,
+        "w", &AnchoredRectF::w,
+        "h", &AnchoredRectF::h);
+    if (binding == EnumBinding::string) {
+        rect["anchor"] = sol::property(
+            [](const AnchoredRectF& r) { return ANCHOR_NAMES[static_cast<int>(r.anchor)]; },
+            [](AnchoredRectF& r, std::string_view name) { r.anchor = anchor_from_name(name); });
+    } else {
+        rect["anchor"] = &AnchoredRectF::anchor;
+    }
+
+    lua.new_usertype<FlaggedPoint>("FlaggedPoint",
+        sol::call_constructor, sol::constructors<FlaggedPoint(int, int, unsigned)>(),
+        "x", &FlaggedPoint::x,
+        "y", &FlaggedPoint::y,
+        "flags", &FlaggedPoint::flags,
+        "has_all", &FlaggedPoint::has_all,
+        "has_any", &FlaggedPoint::has_any);
+}
+
+// ── Lua scripts ───────────────────────────────────────────────────────────────
+
+// n persistent rects and points; anchors cycle through all nine values and
+// flags through every combination of the four layers. Each workload exists
+// once per way of naming a value: Anchor.center, a local hoisted from it, 4,
+// or "center".
+static constexpr const char* ENUM_SCRIPT = R"lua(
+local rects, points
+
+function setup(n)
+    rects, points = {}, {}
+    for i = 1, n do
+        rects[i] = AnchoredRectF(i, 0, 10, 5, i % 9)
+        points[i] = FlaggedPoint(i, -i, i % 16)
+    end
+end
+
+-- Horizontal offset of the anchor: 3-way branch per rect
+
+function branch_enum(n)
+    local sum = 0.0
+    for i = 1, n do
+        local r = rects[i]
+        local a = r.anchor
+        if a == Anchor.center then sum = sum + r.w * 0.5
+        elseif a == Anchor.left or a == Anchor.top_left or a == Anchor.bottom_left then sum = sum + 1
+        elseif a == Anchor.right or a == Anchor.top_right or a == Anchor.bottom_right then sum = sum + r.w
+        else sum = sum + r.w * 0.25 end
+    end
+    return sum
+end
+
+function branch_local(n)
+    local CENTER, LEFT, TOP_LEFT, BOTTOM_LEFT = Anchor.center, Anchor.left, Anchor.top_left, Anchor.bottom_left
+    local RIGHT, TOP_RIGHT, BOTTOM_RIGHT = Anchor.right, Anchor.top_right, Anchor.bottom_right
+    local sum = 0.0
+    for i = 1, n do
+        local r = rects[i]
+        local a = r.anchor
+        if a == CENTER then sum = sum + r.w * 0.5
+        elseif a == LEFT or a == TOP_LEFT or a == BOTTOM_LEFT then sum = sum + 1
+        elseif a == RIGHT or a == TOP_RIGHT or a == BOTTOM_RIGHT then sum = sum + r.w
+        else sum = sum + r.w * 0.25 end
+    end
+    return sum
+end
+
+function branch_int(n)
+    local sum = 0.0
+    for i = 1, n do
+        local r = rects[i]
+        local a = r.anchor
+        if a == 4 then sum = sum + r.w * 0.5
+        elseif a == 3 or a == 0 or a == 6 then sum = sum + 1
+        elseif a == 5 or a == 2 or a == 8 then sum = sum + r.w
+        else sum = sum + r.w * 0.25 end
+    end
+    return sum
+end
+
+function branch_string(n)
+    local sum = 0.0
+    for i = 1, n do
+        local r = rects[i]
+        local a = r.anchor
+        if a == "center" then sum = sum + r.w * 0.5
+        elseif a == "left" or a == "top_left" or a == "bottom_left" then sum = sum + 1
+        elseif a == "right" or a == "top_right" or a == "bottom_right" then sum = sum + r.w
+        else sum = sum + r.w * 0.25 end
+    end
+    return sum
+end
+
+-- Alternate every rect between left and right
+
+function write_enum(n)
+    for i = 1, n do
+        rects[i].anchor = (i % 2 == 0) and Anchor.left or Anchor.right
+    end
+    return n
+end
+
+function write_int(n)
+    for i = 1, n do
+        rects[i].anchor = (i % 2 == 0) and 3 or 5
+    end
+    return n
+end
+
+function write_string(n)
+    for i = 1, n do
+        rects[i].anchor = (i % 2 == 0) and "left" or "right"
+    end
+    return n
+end
+
+-- Points on the player layer and on neither enemy nor trigger. The flag
+-- tests run in C++ through has_all/has_any, or in Lua with arithmetic that
+-- works without bitwise operators.
+
+function flags_method(n)
+    local count = 0
+    for i = 1, n do
+        local p = points[i]
+        if p:has_all(Collision.player) and not p:has_any(Collision.enemy + Collision.trigger) then count = count + 1 end
+    end
+    return count
+end
+
+function flags_method_int(n)
+    local count = 0
+    for i = 1, n do
+        local p = points[i]
+        if p:has_all(2) and not p:has_any(12) then count = count + 1 end
+    end
+    return count
+end
+
+function flags_arith(n)
+    local count = 0
+    for i = 1, n do
+        local f = points[i].flags
+        if f % 4 >= 2 and f % 16 < 4 then count = count + 1 end
+    end
+    return count
+end
+)lua";
+
+#if LUA_VERSION_NUM >= 503
+// The same flag tests with Lua 5.3 bitwise operators, which older parsers
+// reject; appended to ENUM_SCRIPT only there, sharing its locals.
+static constexpr const char* ENUM_BITWISE_SCRIPT = R"lua(
+function flags_bitwise(n)
+    local count = 0
+    for i = 1, n do
+        local f = points[i].flags
+        if f & Collision.player ~= 0 and f & (Collision.enemy | Collision.trigger) == 0 then count = count + 1 end
+    end
+    return count
+end
+
+function flags_bitwise_int(n)
+    local count = 0
+    for i = 1, n do
+        local f = points[i].flags
+        if f & 2 ~= 0 and f & 12 == 0 then count = count + 1 end
+    end
+    return count
+end
+
+-- Toggle the trigger layer on every point
+function toggle_bitwise(n)
+    for i = 1, n do
+        local p = points[i]
+        p.flags = p.flags ~ Collision.trigger
+    end
+    return n
+end
+
+function toggle_bitwise_int(n)
+    for i = 1, n do
+        local p = points[i]
+        p.flags = p.flags ~ 8
+    end
+    return n
+end
+)lua";
+#endif
+
+// ── Benchmarks ────────────────────────────────────────────────────────────────
+
+static void BM_Enums(benchmark::State& state, EnumBinding binding, const char* function) {
+    sol::state lua;
+    open_state(lua);
+    register_enum_usertypes(lua, binding);
+#if LUA_VERSION_NUM >= 503
+    lua.script(std::string(ENUM_SCRIPT) + ENUM_BITWISE_SCRIPT);
+#else
+    lua.script(ENUM_SCRIPT);
+#endif
+    lua["setup"](state.range(0));
+    run_lua_function(state, lua, function);
+}
+
+#define ENUM_BENCHMARK(name, binding, function) \
+    BENCHMARK_CAPTURE(BM_Enums, name, EnumBinding::binding, function)->Arg(1000)->Arg(10000)
+
+ENUM_BENCHMARK(branch_read_only,       read_only, "branch_enum");
+ENUM_BENCHMARK(branch_writable,        writable,  "branch_enum");
+ENUM_BENCHMARK(branch_local,           read_only, "branch_local");
+ENUM_BENCHMARK(branch_integer,         integer,   "branch_int");
+ENUM_BENCHMARK(branch_string,          string,    "branch_string");
+ENUM_BENCHMARK(write_read_only,        read_only, "write_enum");
+ENUM_BENCHMARK(write_writable,         writable,  "write_enum");
+ENUM_BENCHMARK(write_integer,          integer,   "write_int");
+ENUM_BENCHMARK(write_string,           string,    "write_string");
+ENUM_BENCHMARK(flags_method_read_only, read_only, "flags_method");
+ENUM_BENCHMARK(flags_method_writable,  writable,  "flags_method");
+ENUM_BENCHMARK(flags_method_integer,   integer,   "flags_method_int");
+ENUM_BENCHMARK(flags_arithmetic,       integer,   "flags_arith");
+#if LUA_VERSION_NUM >= 503
+ENUM_BENCHMARK(flags_bitwise_read_only,  read_only, "flags_bitwise");
+ENUM_BENCHMARK(flags_bitwise_writable,   writable,  "flags_bitwise");
+ENUM_BENCHMARK(flags_bitwise_integer,    integer,   "flags_bitwise_int");
+ENUM_BENCHMARK(toggle_bitwise_read_only, read_only, "toggle_bitwise");
+ENUM_BENCHMARK(toggle_bitwise_integer,   integer,   "toggle_bitwise_int");
+#endif
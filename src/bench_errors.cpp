@@ -0,0 +1,198 @@
+#include "bench_common.hpp"
+
+#include <stdexcept>
+
+// ── Failing operations ────────────────────────────────────────────────────────
+
+// The same two checked operations, failing three ways. `div` rejects a zero
+// divisor; `dot` rejects a second argument that is not a Vector3.
+//   thrown: sol2-bound lambdas that throw; sol2 catches the exception and the
+//           exception handler turns it into a Lua error
+//   raised: lua_CFunctions that call luaL_error directly
+//   tables: Lua functions on plain tables (defined in ERROR_SCRIPT), failing
+//           through error() or the VM's own type check
+// Whether a Lua error is a longjmp or a C++ exception depends on the build
+// (LUATYPETEST_LUA_AS_CXX), not on the mode.
+
+#if !defined(SOL_NO_EXCEPTIONS) || SOL_NO_EXCEPTIONS == 0
+static Vector2 div_thrown(const Vector2& v, float s) {
+    if (s == 0.0f) {
+        throw std::domain_error("division by zero");
+    }
+    return Vector2{ v.x / s, v.y / s };
+}
+
+static float dot_thrown(const Vector3& a, sol::stack_object b) {
+    if (!b.is<Vector3>()) {
+        throw std::invalid_argument("dot: expected Vector3");
+    }
+    return a.dot(b.as<const Vector3&>());
+}
+#endif
+
+static int div_raised(lua_State* L) {
+    const Vector2& v = sol::stack::get<Vector2&>(L, 1);
+    const float s = static_cast<float>(lua_tonumber(L, 2));
+    if (s == 0.0f) {
+        return luaL_error(L, "division by zero");
+    }
+    return sol::stack::push(L, Vector2{ v.x / s, v.y / s });
+}
+
+static int dot_raised(lua_State* L) {
+    if (!sol::stack::check<Vector3>(L, 2, sol::no_panic)) {
+        return luaL_error(L, "dot: expected Vector3");
+    }
+    lua_pushnumber(L, sol::stack::get<Vector3&>(L, 1).dot(sol::stack::get<Vector3&>(L, 2)));
+    return 1;
+}
+
+static void register_failing_functions(sol::state& lua) {
+#if !defined(SOL_NO_EXCEPTIONS) || SOL_NO_EXCEPTIONS == 0
+    lua.create_named_table("thrown",
+        "div", &div_thrown,
+        "dot", &dot_thrown);
+#endif
+    lua.create_named_table("raised",
+        "div", &div_raised,
+        "dot", &dot_raised);
+}
+
+// ── Lua scripts ───────────────────────────────────────────────────────────────
+
+// setup(mode, n, every) builds n inputs of which every `every`-th makes its
+// operation fail (a zero divisor, a string instead of a Vector3); 0 means none
+// do. Usertype modes use Vector2/Vector3, `tables` plain tables.
+static constexpr const char* ERROR_SCRIPT = R"lua(
+tables = {
+    div = function(v, s)
+        if s == 0 then error("division by zero") end
+        return { x = v.x / s, y = v.y / s }
+    end,
+    -- A string argument fails on b.x (or on arithmetic with nil when the
+    -- string library is open)
+    dot = function(a, b)
+        return a.x * b.x + a.y * b.y + a.z * b.z
+    end,
+}
+
+local ops, vs, ds, a, bs
+
+function setup(mode, n, every)
+    ops = _G[mode]
+    local V2, V3 = Vector2, Vector3
+    if mode == "tables" then
+        V2 = function(x, y) return { x = x, y = y } end
+        V3 = function(x, y, z) return { x = x, y = y, z = z } end
+    end
+    vs, ds, bs = {}, {}, {}
+    a = V3(1, 2, 3)
+    for i = 1, n do
+        local fail = every > 0 and i % every == 0
+        vs[i] = V2(i, -i)
+        ds[i] = fail and 0 or 2
+        bs[i] = fail and "not a vector" or V3(i, 0, -i)
+    end
+end
+
+-- Every call under its own pcall; failures are counted, not rethrown
+
+function divide(n)
+    local div = ops.div
+    local sum, failed = 0.0, 0
+    for i = 1, n do
+        local ok, r = pcall(div, vs[i], ds[i])
+        if ok then sum = sum + r.x else failed = failed + 1 end
+    end
+    return sum + failed
+end
+
+function dot(n)
+    local dot = ops.dot
+    local sum, failed = 0.0, 0
+    for i = 1, n do
+        local ok, r = pcall(dot, a, bs[i])
+        if ok then sum = sum + r else failed = failed + 1 end
+    end
+    return sum + failed
+end
+
+-- The divide loop without pcall, as the baseline; only run with no failures
+function divide_unprotected(n)
+    local div = ops.div
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + div(vs[i], ds[i]).x
+    end
+    return sum
+end
+
+-- One item for the host to call through a protected_function
+function step(i)
+    return ops.div(vs[i], ds[i]).x
+end
+)lua";
+
+// ── Benchmarks ────────────────────────────────────────────────────────────────
+
+static void setup_error_state(benchmark::State& state, sol::state& lua, const char* mode) {
+    open_state(lua);
+    register_usertypes(lua);
+    register_failing_functions(lua);
+    lua.script(ERROR_SCRIPT);
+    lua["setup"](mode, state.range(0), state.range(1));
+}
+
+// Lua catches: pcall around each operation
+static void BM_Errors(benchmark::State& state, const char* mode, const char* function) {
+    sol::state lua;
+    setup_error_state(state, lua, mode);
+    run_lua_function(state, lua, function);
+}
+
+// C++ catches: the host calls step(i) per item through a protected_function
+// and counts the invalid results
+static void BM_ErrorsFromHost(benchmark::State& state, const char* mode) {
+    sol::state lua;
+    setup_error_state(state, lua, mode);
+    sol::protected_function step = lua["step"];
+    const auto n = state.range(0);
+    double sum = 0.0;
+    int failed = 0;
+    for (auto _ : state) {
+        for (int i = 1; i <= n; ++i) {
+            sol::protected_function_result result = step(i);
+            if (result.valid()) {
+                sum += result.get<double>();
+            } else {
+                ++failed;
+            }
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    benchmark::DoNotOptimize(failed);
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+// Second argument: one failing item in every N, 0 for none (0%, 1%, 10%, 50%)
+static void error_rates(benchmark::internal::Benchmark* b) {
+    b->Args({ 10000, 0 })->Args({ 10000, 100 })->Args({ 10000, 10 })->Args({ 10000, 2 });
+}
+
+#define ERROR_BENCHMARK(name, mode, function) \
+    BENCHMARK_CAPTURE(BM_Errors, name, mode, function)->Apply(error_rates)
+
+ERROR_BENCHMARK(divide_raised, "raised", "divide");
+ERROR_BENCHMARK(divide_tables, "tables", "divide");
+ERROR_BENCHMARK(dot_raised,    "raised", "dot");
+ERROR_BENCHMARK(dot_tables,    "tables", "dot");
+BENCHMARK_CAPTURE(BM_Errors, divide_unprotected_raised, "raised", "divide_unprotected")->Args({ 10000, 0 });
+BENCHMARK_CAPTURE(BM_Errors, divide_unprotected_tables, "tables", "divide_unprotected")->Args({ 10000, 0 });
+BENCHMARK_CAPTURE(BM_ErrorsFromHost, raised, "raised")->Apply(error_rates);
+BENCHMARK_CAPTURE(BM_ErrorsFromHost, tables, "tables")->Apply(error_rates);
+#if !defined(SOL_NO_EXCEPTIONS) || SOL_NO_EXCEPTIONS == 0
+ERROR_BENCHMARK(divide_thrown, "thrown", "divide");
+ERROR_BENCHMARK(dot_thrown,    "thrown", "dot");
+BENCHMARK_CAPTURE(BM_Errors, divide_unprotected_thrown, "thrown", "divide_unprotected")->Args({ 10000, 0 });
+BENCHMARK_CAPTURE(BM_ErrorsFromHost, thrown, "thrown")->Apply(error_rates);
+#endif
@@ -0,0 +1,237 @@
+#include "bench_common.hpp"
+
+// ── Table-backed types ────────────────────────────────────────────────────────
+
+// Hybrid representation: Lua sees plain tables with x/y(/z) or x/y/w/h fields,
+// C++ sees the geometry structs. sol2 converts through the sol_lua_check/get/
+// push customization points below whenever a bound function takes or returns
+// one of these types.
+//
+// The Table* wrappers exist only so the customization points apply to them:
+// customizing Vector2 itself would change how every other translation unit's
+// usertype bindings push it.
+namespace {
+
+struct TableVector2 : Vector2 {
+    using Vector2::Vector2;
+    TableVector2(const Vector2& v) : Vector2(v) {}
+};
+struct TableVector3 : Vector3 {
+    using Vector3::Vector3;
+    TableVector3(const Vector3& v) : Vector3(v) {}
+};
+struct TableRectF : RectF {
+    using RectF::RectF;
+};
+struct TablePoint : Point {
+    using Point::Point;
+};
+
+} // namespace
+
+// Vectors carry a shared metatable with the C++ operators and methods; rects
+// and points are bare tables.
+static constexpr const char* VECTOR2_METATABLE = "hybrid.Vector2";
+static constexpr const char* VECTOR3_METATABLE = "hybrid.Vector3";
+
+static void set_number(lua_State* L, const char* name, lua_Number value) {
+    lua_pushnumber(L, value);
+    lua_setfield(L, -2, name);
+}
+
+static void set_integer(lua_State* L, const char* name, lua_Integer value) {
+    lua_pushinteger(L, value);
+    lua_setfield(L, -2, name);
+}
+
+static float get_number(lua_State* L, int index, const char* name) {
+    lua_getfield(L, index, name);
+    const float value = static_cast<float>(lua_tonumber(L, -1));
+    lua_pop(L, 1);
+    return value;
+}
+
+static int get_integer(lua_State* L, int index, const char* name) {
+    lua_getfield(L, index, name);
+    const int value = static_cast<int>(lua_tointeger(L, -1));
+    lua_pop(L, 1);
+    return value;
+}
+
+template <typename Handler>
+static bool check_table(lua_State* L, int index, Handler&& handler, sol::stack::record& tracking) {
+    tracking.use(1);
+    if (lua_type(L, index) != LUA_TTABLE) {
+        handler(L, index, sol::type::table, sol::type_of(L, index), "expected a table");
+        return false;
+    }
+    return true;
+}
+
+// The tables are created with their final number of fields, so filling them
+// never rehashes.
+
+static int sol_lua_push(lua_State* L, const TableVector2& v) {
+    lua_createtable(L, 0, 2);
+    set_number(L, "x", v.x);
+    set_number(L, "y", v.y);
+    luaL_getmetatable(L, VECTOR2_METATABLE);
+    lua_setmetatable(L, -2);
+    return 1;
+}
+
+static int sol_lua_push(lua_State* L, const TableVector3& v) {
+    lua_createtable(L, 0, 3);
+    set_number(L, "x", v.x);
+    set_number(L, "y", v.y);
+    set_number(L, "z", v.z);
+    luaL_getmetatable(L, VECTOR3_METATABLE);
+    lua_setmetatable(L, -2);
+    return 1;
+}
+
+static int sol_lua_push(lua_State* L, const TableRectF& r) {
+    lua_createtable(L, 0, 4);
+    set_number(L, "x", r.x);
+    set_number(L, "y", r.y);
+    set_number(L, "w", r.w);
+    set_number(L, "h", r.h);
+    return 1;
+}
+
+static int sol_lua_push(lua_State* L, const TablePoint& p) {
+    lua_createtable(L, 0, 2);
+    set_integer(L, "x", p.x);
+    set_integer(L, "y", p.y);
+    return 1;
+}
+
+static TableVector2 sol_lua_get(sol::types<TableVector2>, lua_State* L, int index, sol::stack::record& tracking) {
+    tracking.use(1);
+    const int t = lua_absindex(L, index);
+    return TableVector2{ get_number(L, t, "x"), get_number(L, t, "y") };
+}
+
+static TableVector3 sol_lua_get(sol::types<TableVector3>, lua_State* L, int index, sol::stack::record& tracking) {
+    tracking.use(1);
+    const int t = lua_absindex(L, index);
+    return TableVector3{ get_number(L, t, "x"), get_number(L, t, "y"), get_number(L, t, "z") };
+}
+
+static TableRectF sol_lua_get(sol::types<TableRectF>, lua_State* L, int index, sol::stack::record& tracking) {
+    tracking.use(1);
+    const int t = lua_absindex(L, index);
+    return TableRectF{ get_number(L, t, "x"), get_number(L, t, "y"), get_number(L, t, "w"), get_number(L, t, "h") };
+}
+
+static TablePoint sol_lua_get(sol::types<TablePoint>, lua_State* L, int index, sol::stack::record& tracking) {
+    tracking.use(1);
+    const int t = lua_absindex(L, index);
+    return TablePoint{ get_integer(L, t, "x"), get_integer(L, t, "y") };
+}
+
+template <typename Handler>
+static bool sol_lua_check(sol::types<TableVector2>, lua_State* L, int index, Handler&& handler, sol::stack::record& tracking) {
+    return check_table(L, index, handler, tracking);
+}
+
+template <typename Handler>
+static bool sol_lua_check(sol::types<TableVector3>, lua_State* L, int index, Handler&& handler, sol::stack::record& tracking) {
+    return check_table(L, index, handler, tracking);
+}
+
+template <typename Handler>
+static bool sol_lua_check(sol::types<TableRectF>, lua_State* L, int index, Handler&& handler, sol::stack::record& tracking) {
+    return check_table(L, index, handler, tracking);
+}
+
+template <typename Handler>
+static bool sol_lua_check(sol::types<TablePoint>, lua_State* L, int index, Handler&& handler, sol::stack::record& tracking) {
+    return check_table(L, index, handler, tracking);
+}
+
+// ── Registration ──────────────────────────────────────────────────────────────
+
+// The same global names as register_usertypes, so USERTYPE_SCRIPT runs as is.
+// Vector metatables hold the arithmetic metamethods, and their __index is a
+// table of the C++ methods; field reads never leave Lua.
+static void register_hybrid_types(sol::state& lua) {
+    lua.set_function("Vector2", [](float x, float y) { return TableVector2{ x, y }; });
+    lua.set_function("Vector3", [](float x, float y, float z) { return TableVector3{ x, y, z }; });
+    lua.set_function("RectF", [](float x, float y, float w, float h) { return TableRectF{ x, y, w, h }; });
+    lua.set_function("Point", [](int x, int y) { return TablePoint{ x, y }; });
+
+    sol::table registry = lua.registry();
+    registry.set(VECTOR2_METATABLE, lua.create_table_with(
+        "__add",   [](TableVector2 a, TableVector2 b) { return TableVector2{ a.x + b.x, a.y + b.y }; },
+        "__sub",   [](TableVector2 a, TableVector2 b) { return TableVector2{ a.x - b.x, a.y - b.y }; },
+        "__mul",   [](TableVector2 a, float s)        { return TableVector2{ a.x * s,   a.y * s   }; },
+        "__div",   [](TableVector2 a, float s)        { return TableVector2{ a.x / s,   a.y / s   }; },
+        "__index", lua.create_table_with(
+            "dot",       [](TableVector2 a, TableVector2 b) { return a.dot(b); },
+            "length",    [](TableVector2 a) { return a.length(); },
+            "normalize", [](TableVector2 a) { return TableVector2{ a.normalize() }; },
+            "lerp",      [](TableVector2 a, TableVector2 b, float t) { return TableVector2{ a.lerp(b, t) }; })));
+    registry.set(VECTOR3_METATABLE, lua.create_table_with(
+        "__add",   [](TableVector3 a, TableVector3 b) { return TableVector3{ a.x + b.x, a.y + b.y, a.z + b.z }; },
+        "__sub",   [](TableVector3 a, TableVector3 b) { return TableVector3{ a.x - b.x, a.y - b.y, a.z - b.z }; },
+        "__mul",   [](TableVector3 a, float s)        { return TableVector3{ a.x * s,   a.y * s,   a.z * s   }; },
+        "__div",   [](TableVector3 a, float s)        { return TableVector3{ a.x / s,   a.y / s,   a.z / s   }; },
+        "__index", lua.create_table_with(
+            "dot",       [](TableVector3 a, TableVector3 b) { return a.dot(b); },
+            "cross",     [](TableVector3 a, TableVector3 b) { return TableVector3{ a.cross(b) }; },
+            "length",    [](TableVector3 a) { return a.length(); },
+            "normalize", [](TableVector3 a) { return TableVector3{ a.normalize() }; },
+            "lerp",      [](TableVector3 a, TableVector3 b, float t) { return TableVector3{ a.lerp(b, t) }; })));
+}
+
+// ── Lua scripts ───────────────────────────────────────────────────────────────
+
+// Method calls on persistent operands, as in BM_VectorMethods: each call reads
+// its arguments' fields back out of the tables and returns new ones.
+static constexpr const char* HYBRID_METHOD_SCRIPT = R"lua(
+function methods(n)
+    local a2, b2 = Vector2(1, 2), Vector2(3, 5)
+    local a3, b3 = Vector3(1, 2, 3), Vector3(4, 6, 8)
+    local sum = 0.0
+    for i = 1, n do
+        local t = i / n
+        sum = sum + a2:dot(b2) + a2:length() + a2:normalize().x + a2:lerp(b2, t).y
+        sum = sum + a3:dot(b3) + a3:cross(b3).z + a3:length() + a3:normalize().x + a3:lerp(b3, t).y
+    end
+    return sum
+end
+
+-- Field reads only: where the table layout pays off
+function fields(n)
+    local v2, v3 = Vector2(1, 2), Vector3(1, 2, 3)
+    local r, p = RectF(0, 0, 10, 5), Point(3, 4)
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + v2.x + v2.y + v3.x + v3.y + v3.z + r.w * r.h + p.x * p.y
+    end
+    return sum
+end
+)lua";
+
+// ── Benchmarks ────────────────────────────────────────────────────────────────
+
+static void BM_Hybrid(benchmark::State& state, bool hybrid, const char* function) {
+    sol::state lua;
+    open_state(lua);
+    if (hybrid) {
+        register_hybrid_types(lua);
+    } else {
+        register_usertypes(lua);
+        register_vector_methods(lua);
+    }
+    lua.script(USERTYPE_SCRIPT);
+    lua.script(HYBRID_METHOD_SCRIPT);
+    run_lua_function(state, lua, function);
+}
+BENCHMARK_CAPTURE(BM_Hybrid, do_work_hybrid, true, "do_work")->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Hybrid, do_work_usertype, false, "do_work")->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Hybrid, methods_hybrid, true, "methods")->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Hybrid, methods_usertype, false, "methods")->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Hybrid, fields_hybrid, true, "fields")->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Hybrid, fields_usertype, false, "fields")->Arg(100)->Arg(1000)->Arg(10000);
@@ -0,0 +1,234 @@
+#include "bench_common.hpp"
+
+#include <memory>
+#include <vector>
+
+// ── Bindings ──────────────────────────────────────────────────────────────────
+
+enum class ShapeBinding {
+    inherited, // derived types register only their own fields; x, y, area,
+               // contains and move_by resolve through Shape with a runtime cast
+    direct,    // derived types also register the shared members themselves
+};
+
+static float shape_area(const Shape& s) {
+    return s.area();
+}
+
+// nil unless `s` is a RectShape
+static RectShape* as_rect(Shape& s) {
+    return dynamic_cast<RectShape*>(&s);
+}
+
+static void register_shape_usertypes(sol::state& lua, ShapeBinding binding) {
+    lua.new_usertype<Shape>("Shape",
+        sol::no_constructor,
+        "x", &Shape::x,
+        "y", &Shape::y,
+        "area", &Shape::area,
+        "contains", &Shape::contains,
+        "move_by", &Shape::move_by);
+
+    switch (binding) {
+    case ShapeBinding::inherited:
+        lua.new_usertype<RectShape>("RectShape",
+            sol::call_constructor, sol::constructors<RectShape(float, float, float, float)>(),
+            sol::base_classes, sol::bases<Shape>(),
+            "w", &RectShape::w,
+            "h", &RectShape::h);
+        lua.new_usertype<Circle>("Circle",
+            sol::call_constructor, sol::constructors<Circle(float, float, float)>(),
+            sol::base_classes, sol::bases<Shape>(),
+            "r", &Circle::r);
+        break;
+    case ShapeBinding::direct:
+        lua.new_usertype<RectShape>("RectShape",
+            sol::call_constructor, sol::constructors<RectShape(float, float, float, float)>(),
+            sol::base_classes, sol::bases<Shape>(),
+            "x", sol::property([](const RectShape& s) { return s.x; }, [](RectShape& s, float v) { s.x = v; }),
+            "y", sol::property([](const RectShape& s) { return s.y; }, [](RectShape& s, float v) { s.y = v; }),
+            "w", &RectShape::w,
+            "h", &RectShape::h,
+            "area", [](const RectShape& s) { return s.area(); },
+            "contains", [](const RectShape& s, float px, float py) { return s.contains(px, py); },
+            "move_by", [](RectShape& s, float dx, float dy) { s.move_by(dx, dy); });
+        lua.new_usertype<Circle>("Circle",
+            sol::call_constructor, sol::constructors<Circle(float, float, float)>(),
+            sol::base_classes, sol::bases<Shape>(),
+            "x", sol::property([](const Circle& s) { return s.x; }, [](Circle& s, float v) { s.x = v; }),
+            "y", sol::property([](const Circle& s) { return s.y; }, [](Circle& s, float v) { s.y = v; }),
+            "r", &Circle::r,
+            "area", [](const Circle& s) { return s.area(); },
+            "contains", [](const Circle& s, float px, float py) { return s.contains(px, py); },
+            "move_by", [](Circle& s, float dx, float dy) { s.move_by(dx, dy); });
+        break;
+    }
+
+    lua.set_function("shape_area", &shape_area);
+    lua.set_function("as_rect", &as_rect);
+}
+
+// Same shapes as the Lua setup functions build: rects at even indices
+static std::vector<std::unique_ptr<Shape>> make_host_shapes(int n) {
+    std::vector<std::unique_ptr<Shape>> shapes;
+    shapes.reserve(n);
+    for (int i = 1; i <= n; ++i) {
+        if (i % 2 == 0) {
+            shapes.push_back(std::make_unique<RectShape>(float(i % 100), float(i % 50), 10.0f, 5.0f));
+        } else {
+            shapes.push_back(std::make_unique<Circle>(float(i % 100), float(i % 50), 4.0f));
+        }
+    }
+    return shapes;
+}
+
+// ── Lua scripts ───────────────────────────────────────────────────────────────
+
+// n persistent shapes, alternating Circle and RectShape, from one of:
+//   setup_usertype      derived userdata built in Lua
+//   setup_base_pointer  Shape* into host-owned storage, so Lua only sees Shape
+//   setup_table         Lua classes: LRect/LCircle whose metatables chain to
+//                       LShape, which holds the inherited move_by
+static constexpr const char* SHAPE_SCRIPT = R"lua(
+local shapes
+
+function setup_usertype(n)
+    shapes = {}
+    for i = 1, n do
+        if i % 2 == 0 then
+            shapes[i] = RectShape(i % 100, i % 50, 10, 5)
+        else
+            shapes[i] = Circle(i % 100, i % 50, 4)
+        end
+    end
+end
+
+function setup_base_pointer(n)
+    shapes = {}
+    for i = 1, n do
+        shapes[i] = host_shape(i)
+    end
+end
+
+local LShape = {}
+LShape.__index = LShape
+function LShape:move_by(dx, dy) self.x = self.x + dx self.y = self.y + dy end
+
+local LRect = setmetatable({}, LShape)
+LRect.__index = LRect
+function LRect:area() return self.w * self.h end
+function LRect:contains(px, py)
+    return px >= self.x and px <= self.x + self.w and py >= self.y and py <= self.y + self.h
+end
+
+local LCircle = setmetatable({}, LShape)
+LCircle.__index = LCircle
+function LCircle:area() return 3.14159265 * self.r * self.r end
+function LCircle:contains(px, py)
+    local dx, dy = px - self.x, py - self.y
+    return dx * dx + dy * dy <= self.r * self.r
+end
+
+function setup_table(n)
+    shapes = {}
+    for i = 1, n do
+        if i % 2 == 0 then
+            shapes[i] = setmetatable({x=i % 100, y=i % 50, w=10, h=5}, LRect)
+        else
+            shapes[i] = setmetatable({x=i % 100, y=i % 50, r=4}, LCircle)
+        end
+    end
+    as_rect = function(s)
+        if getmetatable(s) == LRect then return s end
+    end
+end
+
+function area(n)
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + shapes[i]:area()
+    end
+    return sum
+end
+
+function contains(n)
+    local count = 0
+    for i = 1, n do
+        if shapes[i]:contains(i * 7 % 100, i * 3 % 50) then count = count + 1 end
+    end
+    return count
+end
+
+function fields(n)
+    local sum = 0.0
+    for i = 1, n do
+        local s = shapes[i]
+        sum = sum + s.x + s.y
+    end
+    return sum
+end
+
+function move(n)
+    for i = 1, n do
+        shapes[i]:move_by(1, -1)
+    end
+    return shapes[n].x
+end
+
+-- Derived userdata passed where C++ expects const Shape&
+function free_function(n)
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + shape_area(shapes[i])
+    end
+    return sum
+end
+
+function downcast(n)
+    local sum = 0.0
+    for i = 1, n do
+        local r = as_rect(shapes[i])
+        if r then sum = sum + r.w end
+    end
+    return sum
+end
+)lua";
+
+// ── Benchmarks ────────────────────────────────────────────────────────────────
+
+static void BM_Inheritance(benchmark::State& state, ShapeBinding binding, const char* setup, const char* function) {
+    // Outlives the state, which holds raw pointers into it after setup_base_pointer
+    auto host_shapes = make_host_shapes(static_cast<int>(state.range(0)));
+    sol::state lua;
+    open_state(lua);
+    register_shape_usertypes(lua, binding);
+    lua.set_function("host_shape", [&host_shapes](int i) -> Shape* { return host_shapes[i - 1].get(); });
+    lua.script(SHAPE_SCRIPT);
+    lua[setup](state.range(0));
+    run_lua_function(state, lua, function);
+}
+
+#define SHAPE_BENCHMARK(name, binding, setup, function) \
+    BENCHMARK_CAPTURE(BM_Inheritance, name, ShapeBinding::binding, setup, function)->Arg(1000)->Arg(10000)
+
+SHAPE_BENCHMARK(area_inherited,              inherited, "setup_usertype",     "area");
+SHAPE_BENCHMARK(area_direct,                 direct,    "setup_usertype",     "area");
+SHAPE_BENCHMARK(area_base_pointer,           inherited, "setup_base_pointer", "area");
+SHAPE_BENCHMARK(area_table,                  inherited, "setup_table",        "area");
+SHAPE_BENCHMARK(contains_inherited,          inherited, "setup_usertype",     "contains");
+SHAPE_BENCHMARK(contains_direct,             direct,    "setup_usertype",     "contains");
+SHAPE_BENCHMARK(contains_base_pointer,       inherited, "setup_base_pointer", "contains");
+SHAPE_BENCHMARK(contains_table,              inherited, "setup_table",        "contains");
+SHAPE_BENCHMARK(fields_inherited,            inherited, "setup_usertype",     "fields");
+SHAPE_BENCHMARK(fields_direct,               direct,    "setup_usertype",     "fields");
+SHAPE_BENCHMARK(fields_base_pointer,         inherited, "setup_base_pointer", "fields");
+SHAPE_BENCHMARK(fields_table,                inherited, "setup_table",        "fields");
+SHAPE_BENCHMARK(move_inherited,              inherited, "setup_usertype",     "move");
+SHAPE_BENCHMARK(move_direct,                 direct,    "setup_usertype",     "move");
+SHAPE_BENCHMARK(move_base_pointer,           inherited, "setup_base_pointer", "move");
+SHAPE_BENCHMARK(move_table,                  inherited, "setup_table",        "move");
+SHAPE_BENCHMARK(free_function_derived,       inherited, "setup_usertype",     "free_function");
+SHAPE_BENCHMARK(free_function_base_pointer,  inherited, "setup_base_pointer", "free_function");
+SHAPE_BENCHMARK(downcast_derived,            inherited, "setup_usertype",     "downcast");
+SHAPE_BENCHMARK(downcast_base_pointer,       inherited, "setup_base_pointer", "downcast");
+SHAPE_BENCHMARK(downcast_table,              inherited, "setup_table",        "downcast");
@@ -0,0 +1,163 @@
+#include "bench_common.hpp"
+
+#include <cstddef>
+#include <vector>
+
+// ── C iterators ───────────────────────────────────────────────────────────────
+
+// Both walk a std::vector<T> sol2 exposes as a container userdata and push each
+// element as a T* userdata, as the container's own __index does.
+
+// each(items): a C closure holding the vector and the next position as upvalues
+template <typename T>
+static int each_next(lua_State* L) {
+    auto& items = *static_cast<std::vector<T>*>(lua_touserdata(L, lua_upvalueindex(1)));
+    const auto i = static_cast<std::size_t>(lua_tointeger(L, lua_upvalueindex(2)));
+    if (i >= items.size()) {
+        return 0;
+    }
+    lua_pushinteger(L, static_cast<lua_Integer>(i + 1));
+    lua_replace(L, lua_upvalueindex(2));
+    return sol::stack::push(L, &items[i]);
+}
+
+template <typename T>
+static int each(lua_State* L) {
+    lua_pushlightuserdata(L, &sol::stack::get<std::vector<T>&>(L, 1));
+    lua_pushinteger(L, 0);
+    lua_pushcclosure(L, &each_next<T>, 2);
+    return 1;
+}
+
+// next_item(items, i): stateless, like ipairs' iterator; returns i + 1 and the
+// element at 1-based position i + 1
+template <typename T>
+static int next_item(lua_State* L) {
+    auto& items = sol::stack::get<std::vector<T>&>(L, 1);
+    const auto i = static_cast<std::size_t>(lua_tointeger(L, 2));
+    if (i >= items.size()) {
+        return 0;
+    }
+    lua_pushinteger(L, static_cast<lua_Integer>(i + 1));
+    sol::stack::push(L, &items[i]);
+    return 2;
+}
+
+static void register_iterators(sol::state& lua) {
+    lua.create_named_table("iter",
+        "each_vectors", &each<Vector3>,
+        "each_rects",   &each<RectF>,
+        "next_vectors", &next_item<Vector3>,
+        "next_rects",   &next_item<RectF>);
+}
+
+// ── Lua scripts ───────────────────────────────────────────────────────────────
+
+// setup(kind, n) picks the `vectors` or `rects` container and copies its n
+// element references into a Lua array. Every loop reads one field per element,
+// so the differences are the iteration itself.
+static constexpr const char* ITERATOR_SCRIPT = R"lua(
+local items, array, each, step
+
+function setup(kind, n)
+    items = _G[kind]
+    each, step = iter["each_" .. kind], iter["next_" .. kind]
+    array = {}
+    for i = 1, n do
+        array[i] = items[i]
+    end
+end
+
+-- Over the Lua array of element userdata
+
+function numeric_for(n)
+    local a = array
+    local sum = 0.0
+    for i = 1, #a do
+        sum = sum + a[i].x
+    end
+    return sum
+end
+
+function ipairs_loop(n)
+    local sum = 0.0
+    for _, v in ipairs(array) do
+        sum = sum + v.x
+    end
+    return sum
+end
+
+-- Over the container userdata; every element is a new T* userdata
+
+function container_index(n)
+    local c = items
+    local sum = 0.0
+    for i = 1, #c do
+        sum = sum + c[i].x
+    end
+    return sum
+end
+
+function closure_iterator(n)
+    local sum = 0.0
+    for v in each(items) do
+        sum = sum + v.x
+    end
+    return sum
+end
+
+function stateless_iterator(n)
+    local sum = 0.0
+    for _, v in step, items, 0 do
+        sum = sum + v.x
+    end
+    return sum
+end
+
+-- sol2's __pairs on the container (Lua 5.2+)
+function container_pairs(n)
+    local sum = 0.0
+    for _, v in pairs(items) do
+        sum = sum + v.x
+    end
+    return sum
+end
+)lua";
+
+// ── Benchmarks ────────────────────────────────────────────────────────────────
+
+static void BM_Iterate(benchmark::State& state, const char* kind, const char* function) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    std::vector<Vector3> vectors;
+    std::vector<RectF> rects;
+    vectors.reserve(n);
+    rects.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        vectors.emplace_back(float(i), 1.0f, 2.0f);
+        rects.emplace_back(float(i), 0.0f, 10.0f, 5.0f);
+    }
+
+    sol::state lua;
+    open_state(lua);
+    register_usertypes(lua);
+    register_iterators(lua);
+    lua["vectors"] = &vectors;
+    lua["rects"] = &rects;
+    lua.script(ITERATOR_SCRIPT);
+    lua["setup"](kind, state.range(0));
+    run_lua_function(state, lua, function);
+}
+
+#define ITERATOR_BENCHMARK(name, function)                                                       \
+    BENCHMARK_CAPTURE(BM_Iterate, name##_vector3, "vectors", function)->Arg(1000)->Arg(100000); \
+    BENCHMARK_CAPTURE(BM_Iterate, name##_rect, "rects", function)->Arg(1000)->Arg(100000)
+
+ITERATOR_BENCHMARK(numeric_for,        "numeric_for");
+ITERATOR_BENCHMARK(ipairs,             "ipairs_loop");
+ITERATOR_BENCHMARK(container_index,    "container_index");
+ITERATOR_BENCHMARK(closure_iterator,   "closure_iterator");
+ITERATOR_BENCHMARK(stateless_iterator, "stateless_iterator");
+// LuaJIT reports 5.1 and, like Lua 5.1, ignores __pairs
+#if LUA_VERSION_NUM >= 502
+ITERATOR_BENCHMARK(container_pairs,    "container_pairs");
+#endif
@@ -0,0 +1,267 @@
+#include "bench_common.hpp"
+
+// ── Metamethod registration ───────────────────────────────────────────────────
+
+// __concat for "label" .. v and v .. "label"
+template <typename T>
+static auto concat_with_string() {
+    return sol::overload(
+        [](const std::string& s, const T& v) { return s + to_string(v); },
+        [](const T& v, const std::string& s) { return to_string(v) + s; });
+}
+
+// Adds comparison, unary and string metamethods to register_usertypes' four
+// types. Kept out of register_usertypes so BM_Usertypes measures the original
+// metatables. Vectors order by squared length, rects by area and points
+// lexicographically, so table.sort needs no comparator.
+void register_metamethods(sol::state& lua) {
+    sol::usertype<Vector2> v2 = lua["Vector2"];
+    v2[sol::meta_function::equal_to]              = [](const Vector2& a, const Vector2& b) { return a == b; };
+    v2[sol::meta_function::less_than]             = [](const Vector2& a, const Vector2& b) { return a.length_sq() < b.length_sq(); };
+    v2[sol::meta_function::less_than_or_equal_to] = [](const Vector2& a, const Vector2& b) { return a.length_sq() <= b.length_sq(); };
+    v2[sol::meta_function::unary_minus]           = [](const Vector2& v) { return Vector2{ -v.x, -v.y }; };
+    v2[sol::meta_function::to_string]             = [](const Vector2& v) { return to_string(v); };
+    v2[sol::meta_function::length]                = &Vector2::length;
+    v2[sol::meta_function::concatenation]         = concat_with_string<Vector2>();
+
+    sol::usertype<Vector3> v3 = lua["Vector3"];
+    v3[sol::meta_function::equal_to]              = [](const Vector3& a, const Vector3& b) { return a == b; };
+    v3[sol::meta_function::less_than]             = [](const Vector3& a, const Vector3& b) { return a.length_sq() < b.length_sq(); };
+    v3[sol::meta_function::less_than_or_equal_to] = [](const Vector3& a, const Vector3& b) { return a.length_sq() <= b.length_sq(); };
+    v3[sol::meta_function::unary_minus]           = [](const Vector3& v) { return Vector3{ -v.x, -v.y, -v.z }; };
+    v3[sol::meta_function::to_string]             = [](const Vector3& v) { return to_string(v); };
+    v3[sol::meta_function::length]                = &Vector3::length;
+    v3[sol::meta_function::concatenation]         = concat_with_string<Vector3>();
+
+    // -r is the rect reflected through the origin, so its far corner moves
+    // to -(x, y) and its size stays the same
+    sol::usertype<RectF> rect = lua["RectF"];
+    rect[sol::meta_function::equal_to]              = [](const RectF& a, const RectF& b) { return a == b; };
+    rect[sol::meta_function::less_than]             = [](const RectF& a, const RectF& b) { return a.area() < b.area(); };
+    rect[sol::meta_function::less_than_or_equal_to] = [](const RectF& a, const RectF& b) { return a.area() <= b.area(); };
+    rect[sol::meta_function::unary_minus]           = [](const RectF& r) { return RectF{ -r.x - r.w, -r.y - r.h, r.w, r.h }; };
+    rect[sol::meta_function::to_string]             = [](const RectF& r) { return to_string(r); };
+    rect[sol::meta_function::length]                = &RectF::area;
+    rect[sol::meta_function::concatenation]         = concat_with_string<RectF>();
+
+    // #p is the squared length, which stays an integer like the coordinates
+    sol::usertype<Point> point = lua["Point"];
+    point[sol::meta_function::equal_to]              = [](const Point& a, const Point& b) { return a == b; };
+    point[sol::meta_function::less_than]             = [](const Point& a, const Point& b) { return a.x < b.x || (a.x == b.x && a.y < b.y); };
+    point[sol::meta_function::less_than_or_equal_to] = [](const Point& a, const Point& b) { return a.x < b.x || (a.x == b.x && a.y <= b.y); };
+    point[sol::meta_function::unary_minus]           = [](const Point& p) { return Point{ -p.x, -p.y }; };
+    point[sol::meta_function::to_string]             = [](const Point& p) { return to_string(p); };
+    point[sol::meta_function::length]                = [](const Point& p) { return p.x * p.x + p.y * p.y; };
+    point[sol::meta_function::concatenation]         = concat_with_string<Point>();
+}
+
+// ── Lua scripts ───────────────────────────────────────────────────────────────
+
+// Three representations behind the same workloads:
+//   usertypes    register_metamethods' metamethods (__eq, __lt, __le, __unm,
+//                __tostring, __len, __concat)
+//   lua classes  tables with a metatable implementing the same metamethods
+//                in Lua (Lua 5.1 and LuaJIT ignore __len on tables)
+//   tables       plain tables and explicit helper functions, no metatables
+// setup_*(n) selects the constructors and builds the shared input arrays.
+static constexpr const char* METAMETHOD_SCRIPT = R"lua(
+local sqrt, format = math.sqrt, string.format
+
+-- Lua classes
+local LVector2 = {}
+LVector2.__index = LVector2
+local function lvector2(x, y) return setmetatable({x=x, y=y}, LVector2) end
+LVector2.__eq       = function(a, b) return a.x == b.x and a.y == b.y end
+LVector2.__lt       = function(a, b) return a.x*a.x + a.y*a.y < b.x*b.x + b.y*b.y end
+LVector2.__le       = function(a, b) return a.x*a.x + a.y*a.y <= b.x*b.x + b.y*b.y end
+LVector2.__unm      = function(v) return lvector2(-v.x, -v.y) end
+LVector2.__tostring = function(v) return format("Vector2(%g, %g)", v.x, v.y) end
+LVector2.__len      = function(v) return sqrt(v.x*v.x + v.y*v.y) end
+LVector2.__concat   = function(a, b) return tostring(a) .. tostring(b) end
+
+local LVector3 = {}
+LVector3.__index = LVector3
+local function lvector3(x, y, z) return setmetatable({x=x, y=y, z=z}, LVector3) end
+LVector3.__eq       = function(a, b) return a.x == b.x and a.y == b.y and a.z == b.z end
+LVector3.__lt       = function(a, b) return a.x*a.x + a.y*a.y + a.z*a.z < b.x*b.x + b.y*b.y + b.z*b.z end
+LVector3.__le       = function(a, b) return a.x*a.x + a.y*a.y + a.z*a.z <= b.x*b.x + b.y*b.y + b.z*b.z end
+LVector3.__unm      = function(v) return lvector3(-v.x, -v.y, -v.z) end
+LVector3.__tostring = function(v) return format("Vector3(%g, %g, %g)", v.x, v.y, v.z) end
+LVector3.__len      = function(v) return sqrt(v.x*v.x + v.y*v.y + v.z*v.z) end
+LVector3.__concat   = function(a, b) return tostring(a) .. tostring(b) end
+
+local LRectF = {}
+LRectF.__index = LRectF
+local function lrectf(x, y, w, h) return setmetatable({x=x, y=y, w=w, h=h}, LRectF) end
+LRectF.__eq       = function(a, b) return a.x == b.x and a.y == b.y and a.w == b.w and a.h == b.h end
+LRectF.__lt       = function(a, b) return a.w*a.h < b.w*b.h end
+LRectF.__le       = function(a, b) return a.w*a.h <= b.w*b.h end
+LRectF.__unm      = function(r) return lrectf(-r.x - r.w, -r.y - r.h, r.w, r.h) end
+LRectF.__tostring = function(r) return format("RectF(%g, %g, %g, %g)", r.x, r.y, r.w, r.h) end
+LRectF.__len      = function(r) return r.w*r.h end
+LRectF.__concat   = function(a, b) return tostring(a) .. tostring(b) end
+
+local LPoint = {}
+LPoint.__index = LPoint
+local function lpoint(x, y) return setmetatable({x=x, y=y}, LPoint) end
+LPoint.__eq       = function(a, b) return a.x == b.x and a.y == b.y end
+LPoint.__lt       = function(a, b) return a.x < b.x or (a.x == b.x and a.y < b.y) end
+LPoint.__le       = function(a, b) return not (b < a) end
+LPoint.__unm      = function(p) return lpoint(-p.x, -p.y) end
+LPoint.__tostring = function(p) return format("Point(%d, %d)", p.x, p.y) end
+LPoint.__len      = function(p) return p.x*p.x + p.y*p.y end
+LPoint.__concat   = function(a, b) return tostring(a) .. tostring(b) end
+
+-- Plain-table helpers
+local function tvector2(x, y) return {x=x, y=y} end
+local function tvector3(x, y, z) return {x=x, y=y, z=z} end
+local function trectf(x, y, w, h) return {x=x, y=y, w=w, h=h} end
+local function tpoint(x, y) return {x=x, y=y} end
+local function v2_lt(a, b) return a.x*a.x + a.y*a.y < b.x*b.x + b.y*b.y end
+local function point_eq(a, b) return a.x == b.x and a.y == b.y end
+
+-- Park-Miller: exact in 64-bit integers and in doubles, so every Lua version
+-- sees the same input. Not in LUA_32BITS builds (LUATYPETEST_LUA_32BITS),
+-- where seed * 16807 overflows the 32-bit integer or float and the sequence
+-- diverges; compare those only with each other.
+local seed = 1
+local function rand(m)
+    seed = (seed * 16807) % 2147483647
+    return seed % m
+end
+
+local V2, V3, R, P
+local vectors, points, palette
+
+local function build(n)
+    seed = 1
+    vectors, points, palette = {}, {}, {}
+    for i = 1, n do
+        vectors[i] = V2(rand(1000), rand(1000))
+        points[i] = P(rand(4), rand(4))
+    end
+    -- 16 distinct points; every input point equals exactly one of them
+    for i = 0, 15 do
+        palette[i + 1] = P(i % 4, math.floor(i / 4))
+    end
+end
+
+function setup_usertypes(n)  V2, V3, R, P = Vector2, Vector3, RectF, Point build(n) end
+function setup_lua_classes(n) V2, V3, R, P = lvector2, lvector3, lrectf, lpoint build(n) end
+function setup_tables(n)     V2, V3, R, P = tvector2, tvector3, trectf, tpoint build(n) end
+
+-- table.sort of n Vector2 by length, through __lt
+function sort_lt(n)
+    local a = {}
+    for i = 1, n do a[i] = vectors[i] end
+    table.sort(a)
+    return a[1].x + a[n].x
+end
+
+function sort_table(n)
+    local a = {}
+    for i = 1, n do a[i] = vectors[i] end
+    table.sort(a, v2_lt)
+    return a[1].x + a[n].x
+end
+
+-- Map each point to its palette index by linear search with ==
+function dedup_eq(n)
+    local sum = 0
+    for i = 1, n do
+        local p = points[i]
+        for k = 1, 16 do
+            if palette[k] == p then sum = sum + k break end
+        end
+    end
+    return sum
+end
+
+function dedup_table(n)
+    local sum = 0
+    for i = 1, n do
+        local p = points[i]
+        for k = 1, 16 do
+            if point_eq(palette[k], p) then sum = sum + k break end
+        end
+    end
+    return sum
+end
+
+-- One log line per item: tostring plus concatenation of each type
+function log_tostring(n)
+    local v3, r = V3(1, 2, 3), R(0, 0, 10, 20)
+    local total = 0
+    for i = 1, n do
+        local line = "entity " .. tostring(vectors[i]) .. " at " .. v3 .. " in " .. r .. " cell " .. points[i]
+        total = total + #line
+    end
+    return total
+end
+
+function log_table(n)
+    local v3, r = V3(1, 2, 3), R(0, 0, 10, 20)
+    local total = 0
+    for i = 1, n do
+        local v, p = vectors[i], points[i]
+        local line = "entity " .. format("Vector2(%g, %g)", v.x, v.y)
+            .. " at " .. format("Vector3(%g, %g, %g)", v3.x, v3.y, v3.z)
+            .. " in " .. format("RectF(%g, %g, %g, %g)", r.x, r.y, r.w, r.h)
+            .. " cell " .. format("Point(%d, %d)", p.x, p.y)
+        total = total + #line
+    end
+    return total
+end
+
+-- __unm, __len and __le on every type
+function unary(n)
+    local v3, r1, r2 = V3(1, 2, 3), R(0, 0, 10, 20), R(1, 1, 5, 5)
+    local sum = 0.0
+    for i = 1, n do
+        local v, p = vectors[i], points[i]
+        sum = sum + (-v).x + #v + (-v3).z + #v3 + (-r1).x + #r1 + (-p).y + #p
+        if r2 <= r1 then sum = sum + 1 end
+        if p <= palette[1] then sum = sum + 1 end
+    end
+    return sum
+end
+
+function unary_table(n)
+    local v3, r1, r2 = V3(1, 2, 3), R(0, 0, 10, 20), R(1, 1, 5, 5)
+    local first = palette[1]
+    local sum = 0.0
+    for i = 1, n do
+        local v, p = vectors[i], points[i]
+        sum = sum + -v.x + sqrt(v.x*v.x + v.y*v.y) + -v3.z + sqrt(v3.x*v3.x + v3.y*v3.y + v3.z*v3.z)
+                  + (-r1.x - r1.w) + r1.w*r1.h + -p.y + (p.x*p.x + p.y*p.y)
+        if r2.w*r2.h <= r1.w*r1.h then sum = sum + 1 end
+        if not (first.x < p.x or (first.x == p.x and first.y < p.y)) then sum = sum + 1 end
+    end
+    return sum
+end
+)lua";
+
+// ── Benchmarks ────────────────────────────────────────────────────────────────
+
+static void BM_Metamethods(benchmark::State& state, const char* setup, const char* function) {
+    sol::state lua;
+    open_state(lua);
+    lua.open_libraries(sol::lib::math, sol::lib::string, sol::lib::table);
+    register_usertypes(lua);
+    register_metamethods(lua);
+    lua.script(METAMETHOD_SCRIPT);
+    lua[setup](state.range(0));
+    run_lua_function(state, lua, function);
+}
+BENCHMARK_CAPTURE(BM_Metamethods, sort_usertype, "setup_usertypes", "sort_lt")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Metamethods, sort_lua_class, "setup_lua_classes", "sort_lt")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Metamethods, sort_table, "setup_tables", "sort_table")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Metamethods, dedup_usertype, "setup_usertypes", "dedup_eq")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Metamethods, dedup_lua_class, "setup_lua_classes", "dedup_eq")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Metamethods, dedup_table, "setup_tables", "dedup_table")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Metamethods, tostring_usertype, "setup_usertypes", "log_tostring")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Metamethods, tostring_lua_class, "setup_lua_classes", "log_tostring")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Metamethods, tostring_table, "setup_tables", "log_table")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Metamethods, unary_usertype, "setup_usertypes", "unary")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Metamethods, unary_lua_class, "setup_lua_classes", "unary")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Metamethods, unary_table, "setup_tables", "unary_table")->Arg(1000)->Arg(10000);
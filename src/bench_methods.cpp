@@ -0,0 +1,155 @@
+#include "bench_common.hpp"
+
+// ── Method registration ───────────────────────────────────────────────────────
+
+// Kept out of register_usertypes so BM_Usertypes measures the original
+// metatables; benchmarks that call these methods add them explicitly.
+void register_vector_methods(sol::state& lua) {
+    sol::usertype<Vector2> v2 = lua["Vector2"];
+    v2["dot"]       = &Vector2::dot;
+    v2["cross"]     = &Vector2::cross;
+    v2["length"]    = &Vector2::length;
+    v2["length_sq"] = &Vector2::length_sq;
+    v2["normalize"] = &Vector2::normalize;
+    v2["lerp"]      = &Vector2::lerp;
+    v2["distance"]  = &Vector2::distance;
+
+    sol::usertype<Vector3> v3 = lua["Vector3"];
+    v3["dot"]       = &Vector3::dot;
+    v3["cross"]     = &Vector3::cross;
+    v3["length"]    = &Vector3::length;
+    v3["length_sq"] = &Vector3::length_sq;
+    v3["normalize"] = &Vector3::normalize;
+    v3["lerp"]      = &Vector3::lerp;
+    v3["distance"]  = &Vector3::distance;
+}
+
+// ── Free-function registration ────────────────────────────────────────────────
+
+// The same methods as plain functions in vec2/vec3 tables, so calls skip the
+// userdata __index lookup: vec2.dot(a, b) instead of a:dot(b).
+static void register_vector_functions(sol::state& lua) {
+    lua.create_named_table("vec2",
+        "dot",       &Vector2::dot,
+        "cross",     &Vector2::cross,
+        "length",    &Vector2::length,
+        "length_sq", &Vector2::length_sq,
+        "normalize", &Vector2::normalize,
+        "lerp",      &Vector2::lerp,
+        "distance",  &Vector2::distance);
+
+    lua.create_named_table("vec3",
+        "dot",       &Vector3::dot,
+        "cross",     &Vector3::cross,
+        "length",    &Vector3::length,
+        "length_sq", &Vector3::length_sq,
+        "normalize", &Vector3::normalize,
+        "lerp",      &Vector3::lerp,
+        "distance",  &Vector3::distance);
+}
+
+// ── Lua scripts ───────────────────────────────────────────────────────────────
+
+// Each function computes dot, cross, length, length_sq, normalize, lerp and
+// distance on a Vector2 pair and a Vector3 pair per iteration. The operands
+// are built once so the loop measures dispatch, not construction.
+static constexpr const char* VECTOR_METHOD_SCRIPT = R"lua(
+function methods_usertype(n)
+    local a2, b2 = Vector2(1, 2), Vector2(3, 5)
+    local a3, b3 = Vector3(1, 2, 3), Vector3(4, 6, 8)
+    local sum = 0.0
+    for i = 1, n do
+        local t = i / n
+        sum = sum + a2:dot(b2) + a2:cross(b2) + a2:length() + a2:length_sq() + a2:distance(b2)
+        sum = sum + a2:normalize().x + a2:lerp(b2, t).y
+        sum = sum + a3:dot(b3) + a3:cross(b3).z + a3:length() + a3:length_sq() + a3:distance(b3)
+        sum = sum + a3:normalize().x + a3:lerp(b3, t).y
+    end
+    return sum
+end
+
+function free_usertype(n)
+    local a2, b2 = Vector2(1, 2), Vector2(3, 5)
+    local a3, b3 = Vector3(1, 2, 3), Vector3(4, 6, 8)
+    local sum = 0.0
+    for i = 1, n do
+        local t = i / n
+        sum = sum + vec2.dot(a2, b2) + vec2.cross(a2, b2) + vec2.length(a2) + vec2.length_sq(a2) + vec2.distance(a2, b2)
+        sum = sum + vec2.normalize(a2).x + vec2.lerp(a2, b2, t).y
+        sum = sum + vec3.dot(a3, b3) + vec3.cross(a3, b3).z + vec3.length(a3) + vec3.length_sq(a3) + vec3.distance(a3, b3)
+        sum = sum + vec3.normalize(a3).x + vec3.lerp(a3, b3, t).y
+    end
+    return sum
+end
+
+-- Only field reads and the + - * / metamethods the original benchmark uses
+function operators_usertype(n)
+    local sqrt = math.sqrt
+    local a2, b2 = Vector2(1, 2), Vector2(3, 5)
+    local a3, b3 = Vector3(1, 2, 3), Vector3(4, 6, 8)
+    local sum = 0.0
+    for i = 1, n do
+        local t = i / n
+        local len_sq2 = a2.x*a2.x + a2.y*a2.y
+        local d2 = a2 - b2
+        sum = sum + (a2.x*b2.x + a2.y*b2.y) + (a2.x*b2.y - a2.y*b2.x) + sqrt(len_sq2) + len_sq2 + sqrt(d2.x*d2.x + d2.y*d2.y)
+        sum = sum + (a2 / sqrt(len_sq2)).x + (a2 + (b2 - a2) * t).y
+
+        local len_sq3 = a3.x*a3.x + a3.y*a3.y + a3.z*a3.z
+        local d3 = a3 - b3
+        local c3 = Vector3(a3.y*b3.z - a3.z*b3.y, a3.z*b3.x - a3.x*b3.z, a3.x*b3.y - a3.y*b3.x)
+        sum = sum + (a3.x*b3.x + a3.y*b3.y + a3.z*b3.z) + c3.z + sqrt(len_sq3) + len_sq3 + sqrt(d3.x*d3.x + d3.y*d3.y + d3.z*d3.z)
+        sum = sum + (a3 / sqrt(len_sq3)).x + (a3 + (b3 - a3) * t).y
+    end
+    return sum
+end
+
+local sqrt = math.sqrt
+
+local function v2_dot(a, b)       return a.x*b.x + a.y*b.y end
+local function v2_cross(a, b)     return a.x*b.y - a.y*b.x end
+local function v2_length_sq(a)    return a.x*a.x + a.y*a.y end
+local function v2_length(a)       return sqrt(a.x*a.x + a.y*a.y) end
+local function v2_normalize(a)    local l = v2_length(a) return {x=a.x/l, y=a.y/l} end
+local function v2_lerp(a, b, t)   return {x=a.x+(b.x-a.x)*t, y=a.y+(b.y-a.y)*t} end
+local function v2_distance(a, b)  local dx, dy = a.x-b.x, a.y-b.y return sqrt(dx*dx + dy*dy) end
+
+local function v3_dot(a, b)       return a.x*b.x + a.y*b.y + a.z*b.z end
+local function v3_cross(a, b)     return {x=a.y*b.z-a.z*b.y, y=a.z*b.x-a.x*b.z, z=a.x*b.y-a.y*b.x} end
+local function v3_length_sq(a)    return a.x*a.x + a.y*a.y + a.z*a.z end
+local function v3_length(a)       return sqrt(a.x*a.x + a.y*a.y + a.z*a.z) end
+local function v3_normalize(a)    local l = v3_length(a) return {x=a.x/l, y=a.y/l, z=a.z/l} end
+local function v3_lerp(a, b, t)   return {x=a.x+(b.x-a.x)*t, y=a.y+(b.y-a.y)*t, z=a.z+(b.z-a.z)*t} end
+local function v3_distance(a, b)  local dx, dy, dz = a.x-b.x, a.y-b.y, a.z-b.z return sqrt(dx*dx + dy*dy + dz*dz) end
+
+function methods_table(n)
+    local a2, b2 = {x=1, y=2}, {x=3, y=5}
+    local a3, b3 = {x=1, y=2, z=3}, {x=4, y=6, z=8}
+    local sum = 0.0
+    for i = 1, n do
+        local t = i / n
+        sum = sum + v2_dot(a2, b2) + v2_cross(a2, b2) + v2_length(a2) + v2_length_sq(a2) + v2_distance(a2, b2)
+        sum = sum + v2_normalize(a2).x + v2_lerp(a2, b2, t).y
+        sum = sum + v3_dot(a3, b3) + v3_cross(a3, b3).z + v3_length(a3) + v3_length_sq(a3) + v3_distance(a3, b3)
+        sum = sum + v3_normalize(a3).x + v3_lerp(a3, b3, t).y
+    end
+    return sum
+end
+)lua";
+
+// ── Benchmarks ────────────────────────────────────────────────────────────────
+
+static void BM_VectorMethods(benchmark::State& state, const char* function) {
+    sol::state lua;
+    open_state(lua);
+    lua.open_libraries(sol::lib::math);
+    register_usertypes(lua);
+    register_vector_methods(lua);
+    register_vector_functions(lua);
+    lua.script(VECTOR_METHOD_SCRIPT);
+    run_lua_function(state, lua, function);
+}
+BENCHMARK_CAPTURE(BM_VectorMethods, method_syntax, "methods_usertype")->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_VectorMethods, free_functions, "free_usertype")->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_VectorMethods, operators, "operators_usertype")->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_VectorMethods, lua_tables, "methods_table")->Arg(100)->Arg(1000)->Arg(10000);
@@ -0,0 +1,143 @@
+#include "bench_common.hpp"
+
+// ── Bindings ──────────────────────────────────────────────────────────────────
+
+enum class NestedAccess {
+    copy,      // r.pos returns a new Vector2 userdata holding a copy
+    reference, // r.pos returns a Vector2 userdata pointing into the rect
+    flattened, // no inner objects: r.x, r.y, r.w, r.h read through to pos/size
+};
+
+static void register_nested_usertype(sol::state& lua, NestedAccess access) {
+    switch (access) {
+    case NestedAccess::copy:
+        lua.new_usertype<NestedRectF>("NestedRectF",
+            sol::call_constructor, sol::constructors<NestedRectF(float, float, float, float)>(),
+            "pos",  sol::property([](const NestedRectF& r) { return r.pos; },  [](NestedRectF& r, const Vector2& v) { r.pos = v; }),
+            "size", sol::property([](const NestedRectF& r) { return r.size; }, [](NestedRectF& r, const Vector2& v) { r.size = v; }));
+        break;
+    case NestedAccess::reference:
+        lua.new_usertype<NestedRectF>("NestedRectF",
+            sol::call_constructor, sol::constructors<NestedRectF(float, float, float, float)>(),
+            "pos",  sol::property([](NestedRectF& r) -> Vector2& { return r.pos; },  [](NestedRectF& r, const Vector2& v) { r.pos = v; }),
+            "size", sol::property([](NestedRectF& r) -> Vector2& { return r.size; }, [](NestedRectF& r, const Vector2& v) { r.size = v; }));
+        break;
+    case NestedAccess::flattened:
+        lua.new_usertype<NestedRectF>("NestedRectF",
+            sol::call_constructor, sol::constructors<NestedRectF(float, float, float, float)>(),
+            "x", sol::property([](const NestedRectF& r) { return r.pos.x; },  [](NestedRectF& r, float v) { r.pos.x = v; }),
+            "y", sol::property([](const NestedRectF& r) { return r.pos.y; },  [](NestedRectF& r, float v) { r.pos.y = v; }),
+            "w", sol::property([](const NestedRectF& r) { return r.size.x; }, [](NestedRectF& r, float v) { r.size.x = v; }),
+            "h", sol::property([](const NestedRectF& r) { return r.size.y; }, [](NestedRectF& r, float v) { r.size.y = v; }));
+        break;
+    }
+}
+
+// ── Lua scripts ───────────────────────────────────────────────────────────────
+
+// n persistent rects, created once by setup_usertype(n) or setup_table(n)
+// (nested {pos={x,y}, size={x,y}} tables); each item reads or moves one rect.
+// Writes through a copied inner Vector2 would be lost, so copy mode moves a
+// rect by copying pos out, changing it and assigning it back.
+static constexpr const char* NESTED_SCRIPT = R"lua(
+local rects
+
+function setup_usertype(n)
+    rects = {}
+    for i = 1, n do
+        rects[i] = NestedRectF(i, i * 0.5, 10 + i % 7, 5 + i % 3)
+    end
+end
+
+function setup_table(n)
+    rects = {}
+    for i = 1, n do
+        rects[i] = {pos={x=i, y=i * 0.5}, size={x=10 + i % 7, y=5 + i % 3}}
+    end
+end
+
+-- Four inner-object lookups per rect
+function read_nested(n)
+    local sum = 0.0
+    for i = 1, n do
+        local r = rects[i]
+        sum = sum + r.pos.x + r.pos.y + r.size.x * r.size.y
+    end
+    return sum
+end
+
+-- The same reads with pos and size hoisted into locals: two lookups per rect
+function read_hoisted(n)
+    local sum = 0.0
+    for i = 1, n do
+        local r = rects[i]
+        local p, s = r.pos, r.size
+        sum = sum + p.x + p.y + s.x * s.y
+    end
+    return sum
+end
+
+function read_flat(n)
+    local sum = 0.0
+    for i = 1, n do
+        local r = rects[i]
+        sum = sum + r.x + r.y + r.w * r.h
+    end
+    return sum
+end
+
+function move_nested(n)
+    for i = 1, n do
+        local r = rects[i]
+        r.pos.x = r.pos.x + 1
+        r.pos.y = r.pos.y - 1
+    end
+    return rects[n].pos.x
+end
+
+function move_copy(n)
+    for i = 1, n do
+        local r = rects[i]
+        local p = r.pos
+        p.x = p.x + 1
+        p.y = p.y - 1
+        r.pos = p
+    end
+    return rects[n].pos.x
+end
+
+function move_flat(n)
+    for i = 1, n do
+        local r = rects[i]
+        r.x = r.x + 1
+        r.y = r.y - 1
+    end
+    return rects[n].x
+end
+)lua";
+
+// ── Benchmarks ────────────────────────────────────────────────────────────────
+
+static void BM_Nested(benchmark::State& state, NestedAccess access, const char* setup, const char* function) {
+    sol::state lua;
+    open_state(lua);
+    register_usertypes(lua);
+    register_nested_usertype(lua, access);
+    lua.script(NESTED_SCRIPT);
+    lua[setup](state.range(0));
+    run_lua_function(state, lua, function);
+}
+
+#define NESTED_BENCHMARK(name, access, setup, function) \
+    BENCHMARK_CAPTURE(BM_Nested, name, NestedAccess::access, setup, function)->Arg(1000)->Arg(10000)
+
+NESTED_BENCHMARK(read_copy,              copy,      "setup_usertype", "read_nested");
+NESTED_BENCHMARK(read_copy_hoisted,      copy,      "setup_usertype", "read_hoisted");
+NESTED_BENCHMARK(read_reference,         reference, "setup_usertype", "read_nested");
+NESTED_BENCHMARK(read_reference_hoisted, reference, "setup_usertype", "read_hoisted");
+NESTED_BENCHMARK(read_flattened,         flattened, "setup_usertype", "read_flat");
+NESTED_BENCHMARK(read_table,             reference, "setup_table",    "read_nested");
+NESTED_BENCHMARK(move_copy,              copy,      "setup_usertype", "move_copy");
+NESTED_BENCHMARK(move_reference,         reference, "setup_usertype", "move_nested");
+NESTED_BENCHMARK(move_flattened,         flattened, "setup_usertype", "move_flat");
+NESTED_BENCHMARK(move_table,             reference, "setup_table",    "move_nested");
@@ -0,0 +1,235 @@
+#include "bench_common.hpp"
+
+// ── Bindings ──────────────────────────────────────────────────────────────────
+
+enum class Binding {
+    single,      // one signature per metamethod/constructor, like register_usertypes
+    overloaded,  // sol::overload and multi-signature sol::constructors
+    type_switch, // hand-written lua_CFunction dispatching on the argument types
+};
+
+enum class Signature { vector_scalar, scalar_vector, vector_vector, vector_matrix };
+
+// Binds only the requested signature, as one plain sol2 lambda
+template <typename V, typename M>
+static void bind_single_multiply(sol::usertype<V>& type, Signature signature) {
+    switch (signature) {
+    case Signature::vector_scalar:
+        type[sol::meta_function::multiplication] = [](const V& v, float s) { return v * s; };
+        break;
+    case Signature::scalar_vector:
+        type[sol::meta_function::multiplication] = [](float s, const V& v) { return s * v; };
+        break;
+    case Signature::vector_vector:
+        type[sol::meta_function::multiplication] = [](const V& a, const V& b) { return a * b; };
+        break;
+    case Signature::vector_matrix:
+        type[sol::meta_function::multiplication] = [](const V& v, const M& m) { return v * m; };
+        break;
+    }
+}
+
+template <typename V, typename M>
+static auto overloaded_multiply() {
+    return sol::overload(
+        [](const V& v, float s)        { return v * s; },
+        [](float s, const V& v)        { return s * v; },
+        [](const V& a, const V& b)     { return a * b; },
+        [](const V& v, const M& m)     { return v * m; });
+}
+
+// What sol::overload has to work out at runtime, written by hand: numbers
+// first, then a metatable check to tell vectors from matrices.
+template <typename V, typename M>
+static int multiply_switch(lua_State* L) {
+    if (lua_type(L, 1) == LUA_TNUMBER) {
+        return sol::stack::push(L, static_cast<float>(lua_tonumber(L, 1)) * sol::stack::get<V&>(L, 2));
+    }
+    const V& v = sol::stack::get<V&>(L, 1);
+    if (lua_type(L, 2) == LUA_TNUMBER) {
+        return sol::stack::push(L, v * static_cast<float>(lua_tonumber(L, 2)));
+    }
+    if (sol::stack::check<V>(L, 2)) {
+        return sol::stack::push(L, v * sol::stack::get<V&>(L, 2));
+    }
+    return sol::stack::push(L, v * sol::stack::get<M&>(L, 2));
+}
+
+// __call constructors; index 1 is the usertype table
+static int vector2_construct_switch(lua_State* L) {
+    switch (lua_gettop(L)) {
+    case 1:
+        return sol::stack::push(L, Vector2{});
+    case 2:
+        if (lua_type(L, 2) == LUA_TNUMBER) {
+            return sol::stack::push(L, Vector2{ static_cast<float>(lua_tonumber(L, 2)) });
+        }
+        return sol::stack::push(L, Vector2{ sol::stack::get<Vector2&>(L, 2) });
+    default:
+        return sol::stack::push(L, Vector2{ static_cast<float>(lua_tonumber(L, 2)), static_cast<float>(lua_tonumber(L, 3)) });
+    }
+}
+
+static int vector3_construct_switch(lua_State* L) {
+    switch (lua_gettop(L)) {
+    case 1:
+        return sol::stack::push(L, Vector3{});
+    case 2:
+        if (lua_type(L, 2) == LUA_TNUMBER) {
+            return sol::stack::push(L, Vector3{ static_cast<float>(lua_tonumber(L, 2)) });
+        }
+        return sol::stack::push(L, Vector3{ sol::stack::get<Vector3&>(L, 2) });
+    default:
+        return sol::stack::push(L, Vector3{ static_cast<float>(lua_tonumber(L, 2)), static_cast<float>(lua_tonumber(L, 3)), static_cast<float>(lua_tonumber(L, 4)) });
+    }
+}
+
+// `signature` picks the one __mul signature bound in Binding::single mode;
+// the other modes bind all four.
+static void register_overload_usertypes(sol::state& lua, Binding binding, Signature signature) {
+    lua.new_usertype<Mat2>("Mat2",
+        sol::call_constructor, sol::constructors<Mat2(float, float, float, float)>());
+    lua.new_usertype<Mat3>("Mat3",
+        sol::call_constructor, sol::constructors<Mat3(float, float, float, float, float, float, float, float, float)>());
+
+    switch (binding) {
+    case Binding::single: {
+        auto v2 = lua.new_usertype<Vector2>("Vector2",
+            sol::call_constructor, sol::constructors<Vector2(float, float)>(),
+            "x", &Vector2::x,
+            "y", &Vector2::y);
+        auto v3 = lua.new_usertype<Vector3>("Vector3",
+            sol::call_constructor, sol::constructors<Vector3(float, float, float)>(),
+            "x", &Vector3::x,
+            "y", &Vector3::y,
+            "z", &Vector3::z);
+        bind_single_multiply<Vector2, Mat2>(v2, signature);
+        bind_single_multiply<Vector3, Mat3>(v3, signature);
+        break;
+    }
+    case Binding::overloaded:
+        lua.new_usertype<Vector2>("Vector2",
+            sol::call_constructor, sol::constructors<Vector2(), Vector2(float), Vector2(float, float), Vector2(const Vector2&)>(),
+            "x", &Vector2::x,
+            "y", &Vector2::y,
+            sol::meta_function::multiplication, overloaded_multiply<Vector2, Mat2>());
+        lua.new_usertype<Vector3>("Vector3",
+            sol::call_constructor, sol::constructors<Vector3(), Vector3(float), Vector3(float, float, float), Vector3(const Vector3&)>(),
+            "x", &Vector3::x,
+            "y", &Vector3::y,
+            "z", &Vector3::z,
+            sol::meta_function::multiplication, overloaded_multiply<Vector3, Mat3>());
+        break;
+    case Binding::type_switch:
+        lua.new_usertype<Vector2>("Vector2",
+            sol::call_constructor, &vector2_construct_switch,
+            "x", &Vector2::x,
+            "y", &Vector2::y,
+            sol::meta_function::multiplication, &multiply_switch<Vector2, Mat2>);
+        lua.new_usertype<Vector3>("Vector3",
+            sol::call_constructor, &vector3_construct_switch,
+            "x", &Vector3::x,
+            "y", &Vector3::y,
+            "z", &Vector3::z,
+            sol::meta_function::multiplication, &multiply_switch<Vector3, Mat3>);
+        break;
+    }
+}
+
+// ── Lua scripts ───────────────────────────────────────────────────────────────
+
+// One Vector2 and one Vector3 operation per item, operands built outside the loop.
+static constexpr const char* OVERLOAD_SCRIPT = R"lua(
+local a2, b2, m2 = Vector2(1, 2), Vector2(3, 5), Mat2(0, 1, -1, 0)
+local a3, b3, m3 = Vector3(1, 2, 3), Vector3(4, 6, 8), Mat3(0, 1, 0, -1, 0, 0, 0, 0, 1)
+
+function mul_vector_scalar(n)
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + (a2 * 2.0).x + (a3 * 2.0).z
+    end
+    return sum
+end
+
+function mul_scalar_vector(n)
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + (2.0 * a2).x + (2.0 * a3).z
+    end
+    return sum
+end
+
+function mul_vector_vector(n)
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + (a2 * b2).x + (a3 * b3).z
+    end
+    return sum
+end
+
+function mul_vector_matrix(n)
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + (a2 * m2).x + (a3 * m3).z
+    end
+    return sum
+end
+
+function construct_xy(n)
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + Vector2(i, i+1).x + Vector3(i, i+1, i+2).z
+    end
+    return sum
+end
+
+function construct_splat(n)
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + Vector2(i).x + Vector3(i).z
+    end
+    return sum
+end
+
+function construct_copy(n)
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + Vector2(a2).x + Vector3(a3).z
+    end
+    return sum
+end
+)lua";
+
+// ── Benchmarks ────────────────────────────────────────────────────────────────
+
+static void BM_Overload(benchmark::State& state, Binding binding, Signature signature, const char* function) {
+    sol::state lua;
+    open_state(lua);
+    register_overload_usertypes(lua, binding, signature);
+    lua.script(OVERLOAD_SCRIPT);
+    run_lua_function(state, lua, function);
+}
+
+#define OVERLOAD_BENCHMARK(name, binding, signature, function) \
+    BENCHMARK_CAPTURE(BM_Overload, name, Binding::binding, Signature::signature, function)->Arg(1000)->Arg(10000)
+
+OVERLOAD_BENCHMARK(single_vector_scalar,      single,      vector_scalar, "mul_vector_scalar");
+OVERLOAD_BENCHMARK(overloaded_vector_scalar,  overloaded,  vector_scalar, "mul_vector_scalar");
+OVERLOAD_BENCHMARK(type_switch_vector_scalar, type_switch, vector_scalar, "mul_vector_scalar");
+OVERLOAD_BENCHMARK(single_scalar_vector,      single,      scalar_vector, "mul_scalar_vector");
+OVERLOAD_BENCHMARK(overloaded_scalar_vector,  overloaded,  scalar_vector, "mul_scalar_vector");
+OVERLOAD_BENCHMARK(type_switch_scalar_vector, type_switch, scalar_vector, "mul_scalar_vector");
+OVERLOAD_BENCHMARK(single_vector_vector,      single,      vector_vector, "mul_vector_vector");
+OVERLOAD_BENCHMARK(overloaded_vector_vector,  overloaded,  vector_vector, "mul_vector_vector");
+OVERLOAD_BENCHMARK(type_switch_vector_vector, type_switch, vector_vector, "mul_vector_vector");
+OVERLOAD_BENCHMARK(single_vector_matrix,      single,      vector_matrix, "mul_vector_matrix");
+OVERLOAD_BENCHMARK(overloaded_vector_matrix,  overloaded,  vector_matrix, "mul_vector_matrix");
+OVERLOAD_BENCHMARK(type_switch_vector_matrix, type_switch, vector_matrix, "mul_vector_matrix");
+
+OVERLOAD_BENCHMARK(single_construct_xy,       single,      vector_scalar, "construct_xy");
+OVERLOAD_BENCHMARK(overloaded_construct_xy,   overloaded,  vector_scalar, "construct_xy");
+OVERLOAD_BENCHMARK(type_switch_construct_xy,  type_switch, vector_scalar, "construct_xy");
+OVERLOAD_BENCHMARK(overloaded_construct_splat,  overloaded,  vector_scalar, "construct_splat");
+OVERLOAD_BENCHMARK(type_switch_construct_splat, type_switch, vector_scalar, "construct_splat");
+OVERLOAD_BENCHMARK(overloaded_construct_copy,   overloaded,  vector_scalar, "construct_copy");
+OVERLOAD_BENCHMARK(type_switch_construct_copy,  type_switch, vector_scalar, "construct_copy");
@@ -0,0 +1,225 @@
+#include "bench_common.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+// ── Custom handle ─────────────────────────────────────────────────────────────
+
+// Reference-counted handle with a plain int count: shared_ptr's ownership
+// model without the atomic increments, standing in for an engine handle type.
+template <typename T>
+class Handle {
+public:
+    template <typename... Args>
+    static Handle make(Args&&... args) {
+        return Handle(new Block{ T(std::forward<Args>(args)...), 1 });
+    }
+
+    Handle() = default;
+    Handle(const Handle& other) noexcept : block_(other.block_) {
+        if (block_) {
+            ++block_->refs;
+        }
+    }
+    Handle(Handle&& other) noexcept : block_(std::exchange(other.block_, nullptr)) {}
+    Handle& operator=(Handle other) noexcept {
+        std::swap(block_, other.block_);
+        return *this;
+    }
+    ~Handle() {
+        if (block_ && --block_->refs == 0) {
+            delete block_;
+        }
+    }
+
+    T* get() const noexcept { return block_ ? &block_->value : nullptr; }
+    T* operator->() const noexcept { return get(); }
+
+private:
+    struct Block {
+        T value;
+        int refs;
+    };
+    explicit Handle(Block* block) noexcept : block_(block) {}
+
+    Block* block_ = nullptr;
+};
+
+// Lets sol2 store a Handle<T> inside the userdata and hand out T& from it,
+// the same way it treats std::unique_ptr and std::shared_ptr.
+namespace sol {
+template <typename T>
+struct unique_usertype_traits<Handle<T>> {
+    static T* get(lua_State*, const Handle<T>& handle) noexcept { return handle.get(); }
+    static bool is_null(lua_State*, const Handle<T>& handle) noexcept { return handle.get() == nullptr; }
+
+    template <typename X>
+    using rebind_actual_type = Handle<X>;
+};
+} // namespace sol
+
+// ── Bindings ──────────────────────────────────────────────────────────────────
+
+// Objects the pointer mode hands out; constructing reuses slots round-robin
+// so the host never allocates.
+struct HostStorage {
+    std::vector<Vector3> vectors;
+    std::vector<RectF> rects;
+    std::size_t next_vector = 0, next_rect = 0;
+
+    explicit HostStorage(std::size_t n) : vectors(n), rects(n, RectF{ 0, 0, 0, 0 }) {}
+
+    Vector3* vector3(float x, float y, float z) {
+        Vector3* v = &vectors[next_vector++ % vectors.size()];
+        *v = Vector3{ x, y, z };
+        return v;
+    }
+    RectF* rect(float x, float y, float w, float h) {
+        RectF* r = &rects[next_rect++ % rects.size()];
+        *r = RectF{ x, y, w, h };
+        return r;
+    }
+};
+
+// One table per ownership model, each with vector3/rect factories; shared and
+// handle also take the owner itself as a C++ argument.
+static void register_ownership_factories(sol::state& lua, HostStorage& storage) {
+    lua.create_named_table("value",
+        "vector3", [](float x, float y, float z) { return Vector3{ x, y, z }; },
+        "rect",    [](float x, float y, float w, float h) { return RectF{ x, y, w, h }; });
+
+    lua.create_named_table("pointer",
+        "vector3", [&storage](float x, float y, float z) { return storage.vector3(x, y, z); },
+        "rect",    [&storage](float x, float y, float w, float h) { return storage.rect(x, y, w, h); });
+
+    lua.create_named_table("unique",
+        "vector3", [](float x, float y, float z) { return std::make_unique<Vector3>(x, y, z); },
+        "rect",    [](float x, float y, float w, float h) { return std::make_unique<RectF>(x, y, w, h); });
+
+    lua.create_named_table("shared",
+        "vector3",  [](float x, float y, float z) { return std::make_shared<Vector3>(x, y, z); },
+        "rect",     [](float x, float y, float w, float h) { return std::make_shared<RectF>(x, y, w, h); },
+        "take",     [](std::shared_ptr<Vector3> v, std::shared_ptr<RectF> r) { return v->x + r->area(); },
+        "take_ref", [](const std::shared_ptr<Vector3>& v, const std::shared_ptr<RectF>& r) { return v->x + r->area(); });
+
+    lua.create_named_table("handle",
+        "vector3", [](float x, float y, float z) { return Handle<Vector3>::make(x, y, z); },
+        "rect",    [](float x, float y, float w, float h) { return Handle<RectF>::make(x, y, w, h); },
+        "take",    [](Handle<Vector3> v, Handle<RectF> r) { return v->x + r->area(); });
+
+    lua.set_function("take_ref", [](const Vector3& v, const RectF& r) { return v.x + r.area(); });
+}
+
+// ── Lua scripts ───────────────────────────────────────────────────────────────
+
+// setup(mode, n) selects the factory table and builds n persistent Vector3 and
+// RectF through it. Each item handles one of each.
+static constexpr const char* OWNERSHIP_SCRIPT = R"lua(
+local own
+local vectors, rects
+
+function setup(mode, n)
+    own = _G[mode]
+    vectors, rects = {}, {}
+    for i = 1, n do
+        vectors[i] = own.vector3(i, i + 1, i + 2)
+        rects[i] = own.rect(i, i, 10, 5)
+    end
+end
+
+function construct(n)
+    local vector3, rect = own.vector3, own.rect
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + vector3(i, 1, 2).x + rect(i, 0, 10, 5).w
+    end
+    return sum
+end
+
+-- Ends with a full collection, so every object built is also destroyed
+-- inside the measurement
+function construct_collect(n)
+    local sum = construct(n)
+    collectgarbage()
+    return sum
+end
+
+function fields(n)
+    local sum = 0.0
+    for i = 1, n do
+        local v, r = vectors[i], rects[i]
+        sum = sum + v.x + v.y + v.z + r.w * r.h
+    end
+    return sum
+end
+
+-- C++ takes const T&, whatever owns the object
+function pass_ref(n)
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + take_ref(vectors[i], rects[i])
+    end
+    return sum
+end
+
+-- C++ takes the owner by value: a refcount increment and decrement per argument
+function pass_owner(n)
+    local take = own.take
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + take(vectors[i], rects[i])
+    end
+    return sum
+end
+
+function pass_owner_ref(n)
+    local take = own.take_ref
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + take(vectors[i], rects[i])
+    end
+    return sum
+end
+)lua";
+
+// ── Benchmarks ────────────────────────────────────────────────────────────────
+
+static void BM_Ownership(benchmark::State& state, const char* mode, const char* function) {
+    // Outlives the state, which holds raw pointers into it in pointer mode
+    HostStorage storage(static_cast<std::size_t>(state.range(0)));
+    sol::state lua;
+    open_state(lua);
+    register_usertypes(lua);
+    register_ownership_factories(lua, storage);
+    lua.script(OWNERSHIP_SCRIPT);
+    lua["setup"](mode, state.range(0));
+    run_lua_function(state, lua, function);
+}
+
+#define OWNERSHIP_BENCHMARK(name, mode, function) \
+    BENCHMARK_CAPTURE(BM_Ownership, name, mode, function)->Arg(1000)->Arg(10000)
+
+OWNERSHIP_BENCHMARK(construct_value,           "value",   "construct");
+OWNERSHIP_BENCHMARK(construct_pointer,         "pointer", "construct");
+OWNERSHIP_BENCHMARK(construct_unique,          "unique",  "construct");
+OWNERSHIP_BENCHMARK(construct_shared,          "shared",  "construct");
+OWNERSHIP_BENCHMARK(construct_handle,          "handle",  "construct");
+OWNERSHIP_BENCHMARK(construct_collect_value,   "value",   "construct_collect");
+OWNERSHIP_BENCHMARK(construct_collect_pointer, "pointer", "construct_collect");
+OWNERSHIP_BENCHMARK(construct_collect_unique,  "unique",  "construct_collect");
+OWNERSHIP_BENCHMARK(construct_collect_shared,  "shared",  "construct_collect");
+OWNERSHIP_BENCHMARK(construct_collect_handle,  "handle",  "construct_collect");
+OWNERSHIP_BENCHMARK(fields_value,              "value",   "fields");
+OWNERSHIP_BENCHMARK(fields_pointer,            "pointer", "fields");
+OWNERSHIP_BENCHMARK(fields_unique,             "unique",  "fields");
+OWNERSHIP_BENCHMARK(fields_shared,             "shared",  "fields");
+OWNERSHIP_BENCHMARK(fields_handle,             "handle",  "fields");
+OWNERSHIP_BENCHMARK(pass_ref_value,            "value",   "pass_ref");
+OWNERSHIP_BENCHMARK(pass_ref_pointer,          "pointer", "pass_ref");
+OWNERSHIP_BENCHMARK(pass_ref_unique,           "unique",  "pass_ref");
+OWNERSHIP_BENCHMARK(pass_ref_shared,           "shared",  "pass_ref");
+OWNERSHIP_BENCHMARK(pass_ref_handle,           "handle",  "pass_ref");
+OWNERSHIP_BENCHMARK(pass_owner_shared,         "shared",  "pass_owner");
+OWNERSHIP_BENCHMARK(pass_owner_ref_shared,     "shared",  "pass_owner_ref");
+OWNERSHIP_BENCHMARK(pass_owner_handle,         "handle",  "pass_owner");
@@ -0,0 +1,164 @@
+#include "bench_common.hpp"
+
+// ── Field bindings ────────────────────────────────────────────────────────────
+
+enum class FieldStyle {
+    member_pointer, // &Vector2::x, as in register_usertypes
+    property,       // sol::property with getter/setter lambdas
+    readonly,       // sol::readonly(&Vector2::x)
+};
+
+// Vector2 and RectF with their fields bound in `style`. The computed
+// properties, their method equivalents and the class-level sol::var are the
+// same in every style.
+static void register_property_usertypes(sol::state& lua, FieldStyle style) {
+    sol::usertype<Vector2> v2 = lua.new_usertype<Vector2>("Vector2",
+        sol::call_constructor, sol::constructors<Vector2(float, float)>(),
+        "length",     sol::property(&Vector2::length),
+        "get_length", &Vector2::length,
+        "scale",      sol::var(2.0f));
+    sol::usertype<RectF> rect = lua.new_usertype<RectF>("RectF",
+        sol::call_constructor, sol::constructors<RectF(float, float, float, float)>(),
+        "area",     sol::property(&RectF::area),
+        "get_area", &RectF::area);
+
+    switch (style) {
+    case FieldStyle::member_pointer:
+        v2["x"] = &Vector2::x;
+        v2["y"] = &Vector2::y;
+        rect["w"] = &RectF::w;
+        rect["h"] = &RectF::h;
+        break;
+    case FieldStyle::property:
+        v2["x"] = sol::property([](const Vector2& v) { return v.x; }, [](Vector2& v, float x) { v.x = x; });
+        v2["y"] = sol::property([](const Vector2& v) { return v.y; }, [](Vector2& v, float y) { v.y = y; });
+        rect["w"] = sol::property([](const RectF& r) { return r.w; }, [](RectF& r, float w) { r.w = w; });
+        rect["h"] = sol::property([](const RectF& r) { return r.h; }, [](RectF& r, float h) { r.h = h; });
+        break;
+    case FieldStyle::readonly:
+        v2["x"] = sol::readonly(&Vector2::x);
+        v2["y"] = sol::readonly(&Vector2::y);
+        rect["w"] = sol::readonly(&RectF::w);
+        rect["h"] = sol::readonly(&RectF::h);
+        break;
+    }
+}
+
+// ── Lua scripts ───────────────────────────────────────────────────────────────
+
+// Objects are built once; each item reads or writes four fields, or reads two
+// computed values.
+static constexpr const char* PROPERTY_SCRIPT = R"lua(
+local sqrt = math.sqrt
+
+function read_usertype(n)
+    local v, r = Vector2(1, 2), RectF(0, 0, 3, 4)
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + v.x + v.y + r.w + r.h
+    end
+    return sum
+end
+
+function read_table(n)
+    local v, r = {x=1, y=2}, {x=0, y=0, w=3, h=4}
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + v.x + v.y + r.w + r.h
+    end
+    return sum
+end
+
+function write_usertype(n)
+    local v, r = Vector2(1, 2), RectF(0, 0, 3, 4)
+    for i = 1, n do
+        v.x = i
+        v.y = i
+        r.w = i
+        r.h = i
+    end
+    return v.x + v.y + r.w + r.h
+end
+
+function write_table(n)
+    local v, r = {x=1, y=2}, {x=0, y=0, w=3, h=4}
+    for i = 1, n do
+        v.x = i
+        v.y = i
+        r.w = i
+        r.h = i
+    end
+    return v.x + v.y + r.w + r.h
+end
+
+function computed_property(n)
+    local v, r = Vector2(3, 4), RectF(0, 0, 3, 4)
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + r.area + v.length
+    end
+    return sum
+end
+
+function computed_method(n)
+    local v, r = Vector2(3, 4), RectF(0, 0, 3, 4)
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + r:get_area() + v:get_length()
+    end
+    return sum
+end
+
+-- Computed in Lua from the bound fields
+function computed_fields(n)
+    local v, r = Vector2(3, 4), RectF(0, 0, 3, 4)
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + r.w * r.h + sqrt(v.x * v.x + v.y * v.y)
+    end
+    return sum
+end
+
+function computed_table(n)
+    local v, r = {x=3, y=4}, {x=0, y=0, w=3, h=4}
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + r.w * r.h + sqrt(v.x * v.x + v.y * v.y)
+    end
+    return sum
+end
+
+-- sol::var lives on the usertype, not in the object
+function read_var(n)
+    local v = Vector2(1, 2)
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + v.scale + v.scale + v.scale + v.scale
+    end
+    return sum
+end
+)lua";
+
+// ── Benchmarks ────────────────────────────────────────────────────────────────
+
+static void BM_Fields(benchmark::State& state, FieldStyle style, const char* function) {
+    sol::state lua;
+    open_state(lua);
+    lua.open_libraries(sol::lib::math);
+    register_property_usertypes(lua, style);
+    lua.script(PROPERTY_SCRIPT);
+    run_lua_function(state, lua, function);
+}
+BENCHMARK_CAPTURE(BM_Fields, member_pointer_read, FieldStyle::member_pointer, "read_usertype")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Fields, property_read, FieldStyle::property, "read_usertype")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Fields, readonly_read, FieldStyle::readonly, "read_usertype")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Fields, table_read, FieldStyle::member_pointer, "read_table")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Fields, member_pointer_write, FieldStyle::member_pointer, "write_usertype")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Fields, property_write, FieldStyle::property, "write_usertype")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Fields, table_write, FieldStyle::member_pointer, "write_table")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Fields, computed_property, FieldStyle::member_pointer, "computed_property")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Fields, computed_method, FieldStyle::member_pointer, "computed_method")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Fields, computed_from_member_pointers, FieldStyle::member_pointer, "computed_fields")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Fields, computed_from_properties, FieldStyle::property, "computed_fields")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Fields, computed_table, FieldStyle::member_pointer, "computed_table")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Fields, var_read, FieldStyle::member_pointer, "read_var")->Arg(1000)->Arg(10000);
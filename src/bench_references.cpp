@@ -0,0 +1,223 @@
+#include "bench_common.hpp"
+
+#include <cstddef>
+#include <vector>
+
+// ── Handle holders ────────────────────────────────────────────────────────────
+
+// Each holder keeps host-side handles to Lua values, one per entity, with the
+// same four operations:
+//   hold(): take a handle to the value on top of the stack and pop it
+//   replace(i): point handle i at the value on top of the stack and pop it
+//   push(i): push the value of handle i
+//   clear(): drop every handle
+// `items` is the stack index of the Lua array the values come from; the pool
+// keeps its own table just above it.
+
+// sol::object and sol::main_object: one luaL_ref/luaL_unref per handle.
+// main_object also looks up the main thread on every ref.
+template <typename Object>
+struct SolHolder {
+    lua_State* L;
+    std::vector<Object> handles;
+
+    SolHolder(lua_State* L, int) : L(L) {}
+
+    void hold() {
+        handles.emplace_back(L, -1);
+        lua_pop(L, 1);
+    }
+    void replace(std::size_t i) {
+        handles[i] = Object(L, -1);
+        lua_pop(L, 1);
+    }
+    void push(std::size_t i) { handles[i].push(L); }
+    void clear() { handles.clear(); }
+};
+
+// sol::stack_object: no registry at all, but the values must stay on the Lua
+// stack for as long as the handles live
+struct StackHolder {
+    lua_State* L;
+    int base;
+    std::vector<sol::stack_object> handles;
+
+    StackHolder(lua_State* L, int) : L(L), base(lua_gettop(L)) {}
+
+    void hold() { handles.emplace_back(L, -1); }
+    void replace(std::size_t i) { lua_replace(L, handles[i].stack_index()); }
+    void push(std::size_t i) { lua_pushvalue(L, handles[i].stack_index()); }
+    void clear() {
+        handles.clear();
+        lua_settop(L, base);
+    }
+};
+
+// What sol::object does, with the C API and plain ints
+struct RawRefHolder {
+    lua_State* L;
+    std::vector<int> refs;
+
+    RawRefHolder(lua_State* L, int) : L(L) {}
+
+    void hold() { refs.push_back(luaL_ref(L, LUA_REGISTRYINDEX)); }
+    void replace(std::size_t i) {
+        luaL_unref(L, LUA_REGISTRYINDEX, refs[i]);
+        refs[i] = luaL_ref(L, LUA_REGISTRYINDEX);
+    }
+    void push(std::size_t i) { lua_rawgeti(L, LUA_REGISTRYINDEX, refs[i]); }
+    void clear() {
+        for (int ref : refs) {
+            luaL_unref(L, LUA_REGISTRYINDEX, ref);
+        }
+        refs.clear();
+    }
+};
+
+// Slots in one pool table owned by the host, recycled through a C++ free list.
+// Replacing overwrites the slot in place, and releasing never touches Lua: the
+// old value stays reachable until its slot is reused.
+struct PoolHolder {
+    lua_State* L;
+    int pool;
+    int next_slot = 0;
+    std::vector<int> slots, free_slots;
+
+    PoolHolder(lua_State* L, int items) : L(L), pool(items + 1) {
+        lua_newtable(L);
+        lua_replace(L, pool);
+    }
+
+    void hold() {
+        int slot;
+        if (free_slots.empty()) {
+            slot = ++next_slot;
+        } else {
+            slot = free_slots.back();
+            free_slots.pop_back();
+        }
+        lua_rawseti(L, pool, slot);
+        slots.push_back(slot);
+    }
+    void replace(std::size_t i) { lua_rawseti(L, pool, slots[i]); }
+    void push(std::size_t i) { lua_rawgeti(L, pool, slots[i]); }
+    void clear() {
+        free_slots.insert(free_slots.end(), slots.rbegin(), slots.rend());
+        slots.clear();
+    }
+};
+
+// ── Workloads ─────────────────────────────────────────────────────────────────
+
+using ReferenceLoop = void (*)(benchmark::State&, lua_State*, int items, int n);
+
+// Entities spawning and despawning: n handles taken, then all dropped
+template <typename Holder>
+static void churn_handles(benchmark::State& state, lua_State* L, int items, int n) {
+    Holder holder(L, items);
+    for (auto _ : state) {
+        for (int i = 1; i <= n; ++i) {
+            lua_rawgeti(L, items, i);
+            holder.hold();
+        }
+        holder.clear();
+    }
+}
+
+// Every entity's handle re-pointed once per iteration
+template <typename Holder>
+static void replace_handles(benchmark::State& state, lua_State* L, int items, int n) {
+    Holder holder(L, items);
+    for (int i = 1; i <= n; ++i) {
+        lua_rawgeti(L, items, i);
+        holder.hold();
+    }
+    for (auto _ : state) {
+        for (int i = 1; i <= n; ++i) {
+            lua_rawgeti(L, items, n + 1 - i);
+            holder.replace(static_cast<std::size_t>(i - 1));
+        }
+    }
+    holder.clear();
+}
+
+// Held handles pushed back and their `x` read
+template <typename Holder>
+static void read_handles(benchmark::State& state, lua_State* L, int items, int n) {
+    Holder holder(L, items);
+    for (int i = 1; i <= n; ++i) {
+        lua_rawgeti(L, items, i);
+        holder.hold();
+    }
+    double sum = 0.0;
+    for (auto _ : state) {
+        for (int i = 0; i < n; ++i) {
+            holder.push(static_cast<std::size_t>(i));
+            lua_getfield(L, -1, "x");
+            sum += lua_tonumber(L, -1);
+            lua_pop(L, 2);
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    holder.clear();
+}
+
+// ── Lua scripts ───────────────────────────────────────────────────────────────
+
+// The values the handles point at: n Vector2 userdata or n {x, y} tables
+static constexpr const char* REFERENCE_SCRIPT = R"lua(
+items = {}
+
+function setup(kind, n)
+    items = {}
+    for i = 1, n do
+        if kind == "table" then
+            items[i] = { x = i, y = -i }
+        else
+            items[i] = Vector2(i, -i)
+        end
+    end
+end
+)lua";
+
+// ── Benchmarks ────────────────────────────────────────────────────────────────
+
+static void BM_References(benchmark::State& state, const char* kind, ReferenceLoop loop) {
+    sol::state lua;
+    open_state(lua);
+    register_usertypes(lua);
+    lua.script(REFERENCE_SCRIPT);
+    lua["setup"](kind, state.range(0));
+
+    // items, the pool table and, for stack_object, one slot per handle. The
+    // sizes stay under the 8000-slot C stack limit of Lua 5.1 and LuaJIT.
+    lua_State* L = lua.lua_state();
+    const int n = static_cast<int>(state.range(0));
+    if (!lua_checkstack(L, n + 4)) {
+        state.SkipWithError("Lua stack cannot hold one value per handle");
+        return;
+    }
+    lua_getglobal(L, "items");
+    const int items = lua_gettop(L);
+    lua_pushnil(L);
+    loop(state, L, items, n);
+    lua_settop(L, items - 1);
+    state.SetItemsProcessed(state.iterations() * n);
+}
+
+#define REFERENCE_BENCHMARK(name, kind, loop) \
+    BENCHMARK_CAPTURE(BM_References, name, kind, loop)->Arg(1000)->Arg(5000)
+
+#define REFERENCE_BENCHMARKS(holder, Holder)                                                \
+    REFERENCE_BENCHMARK(churn_##holder##_userdata,   "userdata", &churn_handles<Holder>);   \
+    REFERENCE_BENCHMARK(churn_##holder##_table,      "table",    &churn_handles<Holder>);   \
+    REFERENCE_BENCHMARK(replace_##holder##_userdata, "userdata", &replace_handles<Holder>); \
+    REFERENCE_BENCHMARK(replace_##holder##_table,    "table",    &replace_handles<Holder>); \
+    REFERENCE_BENCHMARK(read_##holder##_userdata,    "userdata", &read_handles<Holder>);    \
+    REFERENCE_BENCHMARK(read_##holder##_table,       "table",    &read_handles<Holder>)
+
+REFERENCE_BENCHMARKS(object,       SolHolder<sol::object>);
+REFERENCE_BENCHMARKS(main_object,  SolHolder<sol::main_object>);
+REFERENCE_BENCHMARKS(stack_object, StackHolder);
+REFERENCE_BENCHMARKS(raw_ref,      RawRefHolder);
+REFERENCE_BENCHMARKS(pool,         PoolHolder);
@@ -0,0 +1,207 @@
+#include "bench_common.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <variant>
+
+// ── Query functions ───────────────────────────────────────────────────────────
+
+// Slab test: the first point where the ray enters the rect, if any
+static std::optional<Vector2> ray_rect(const Vector2& origin, const Vector2& dir, const RectF& r) {
+    const float o[2] = { origin.x, origin.y }, d[2] = { dir.x, dir.y };
+    const float lo[2] = { r.x, r.y }, hi[2] = { r.x + r.w, r.y + r.h };
+    float t_enter = 0.0f, t_exit = std::numeric_limits<float>::infinity();
+    for (int axis = 0; axis < 2; ++axis) {
+        if (d[axis] == 0.0f) {
+            if (o[axis] < lo[axis] || o[axis] > hi[axis]) {
+                return std::nullopt;
+            }
+            continue;
+        }
+        float t1 = (lo[axis] - o[axis]) / d[axis], t2 = (hi[axis] - o[axis]) / d[axis];
+        if (t1 > t2) {
+            std::swap(t1, t2);
+        }
+        t_enter = std::max(t_enter, t1);
+        t_exit = std::min(t_exit, t2);
+        if (t_enter > t_exit) {
+            return std::nullopt;
+        }
+    }
+    return Vector2{ origin.x + dir.x * t_enter, origin.y + dir.y * t_enter };
+}
+
+// Even ids name a rect, odd ids a grid cell
+static std::variant<RectF, Point> lookup(int id) {
+    if (id % 2 == 0) {
+        return RectF{ float(id), 0.0f, 10.0f, 5.0f };
+    }
+    return Point{ id, -id };
+}
+
+static std::tuple<float, float> rect_center(const RectF& r) {
+    return { r.x + r.w * 0.5f, r.y + r.h * 0.5f };
+}
+
+static Vector2 rect_center_vector(const RectF& r) {
+    return Vector2{ r.x + r.w * 0.5f, r.y + r.h * 0.5f };
+}
+
+// Area after growing by dx, dy; either may be omitted
+static float grow(const RectF& r, sol::optional<float> dx, sol::optional<float> dy) {
+    return (r.w + dx.value_or(0.0f)) * (r.h + dy.value_or(0.0f));
+}
+
+// ── Raw API equivalents ───────────────────────────────────────────────────────
+
+// Same computations, with nil, multiple returns and optional arguments handled
+// by hand; sol2 only pushes and reads the userdata.
+static int ray_rect_raw(lua_State* L) {
+    const auto hit = ray_rect(sol::stack::get<Vector2&>(L, 1), sol::stack::get<Vector2&>(L, 2), sol::stack::get<RectF&>(L, 3));
+    if (!hit) {
+        lua_pushnil(L);
+        return 1;
+    }
+    return sol::stack::push(L, *hit);
+}
+
+static int lookup_raw(lua_State* L) {
+    const int id = static_cast<int>(lua_tointeger(L, 1));
+    if (id % 2 == 0) {
+        return sol::stack::push(L, RectF{ float(id), 0.0f, 10.0f, 5.0f });
+    }
+    return sol::stack::push(L, Point{ id, -id });
+}
+
+static int rect_center_raw(lua_State* L) {
+    const RectF& r = sol::stack::get<RectF&>(L, 1);
+    lua_pushnumber(L, r.x + r.w * 0.5f);
+    lua_pushnumber(L, r.y + r.h * 0.5f);
+    return 2;
+}
+
+static int rect_center_vector_raw(lua_State* L) {
+    return sol::stack::push(L, rect_center_vector(sol::stack::get<RectF&>(L, 1)));
+}
+
+static int grow_raw(lua_State* L) {
+    const RectF& r = sol::stack::get<RectF&>(L, 1);
+    const lua_Number dx = luaL_optnumber(L, 2, 0.0);
+    const lua_Number dy = luaL_optnumber(L, 3, 0.0);
+    lua_pushnumber(L, (r.w + dx) * (r.h + dy));
+    return 1;
+}
+
+static void register_query_functions(sol::state& lua) {
+    lua.create_named_table("bound",
+        "ray_rect",           &ray_rect,
+        "lookup",             &lookup,
+        "rect_center",        &rect_center,
+        "rect_center_vector", &rect_center_vector,
+        "grow",               &grow);
+
+    lua.create_named_table("raw",
+        "ray_rect",           &ray_rect_raw,
+        "lookup",             &lookup_raw,
+        "rect_center",        &rect_center_raw,
+        "rect_center_vector", &rect_center_vector_raw,
+        "grow",               &grow_raw);
+}
+
+// ── Lua scripts ───────────────────────────────────────────────────────────────
+
+// setup(mode, n) picks the sol2-bound table or the raw one and builds n ray
+// directions spread around the circle; about 40% of them hit the rect.
+static constexpr const char* RETURN_SCRIPT = R"lua(
+local q
+local origin, target, dirs
+
+function setup(mode, n)
+    q = _G[mode]
+    origin, target = Vector2(0, 0), RectF(5, -20, 10, 40)
+    dirs = {}
+    for i = 1, n do
+        local a = (i % 64) / 64 * 2 * math.pi
+        dirs[i] = Vector2(math.cos(a), math.sin(a))
+    end
+end
+
+-- std::optional<Vector2>: nil on a miss
+function ray_hits(n)
+    local ray_rect = q.ray_rect
+    local sum = 0.0
+    for i = 1, n do
+        local hit = ray_rect(origin, dirs[i], target)
+        if hit then sum = sum + hit.x end
+    end
+    return sum
+end
+
+-- std::variant<RectF, Point>
+function lookup(n)
+    local lookup = q.lookup
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + lookup(i).x
+    end
+    return sum
+end
+
+-- std::tuple<float, float>: two return values
+function center(n)
+    local rect_center = q.rect_center
+    local sum = 0.0
+    for i = 1, n do
+        local x, y = rect_center(target)
+        sum = sum + x + y
+    end
+    return sum
+end
+
+-- The same result as one Vector2 userdata
+function center_vector(n)
+    local rect_center_vector = q.rect_center_vector
+    local sum = 0.0
+    for i = 1, n do
+        local c = rect_center_vector(target)
+        sum = sum + c.x + c.y
+    end
+    return sum
+end
+
+-- sol::optional<float> arguments: none, one and both given
+function optional_args(n)
+    local grow = q.grow
+    local sum = 0.0
+    for i = 1, n do
+        sum = sum + grow(target) + grow(target, 1) + grow(target, 1, 2)
+    end
+    return sum
+end
+)lua";
+
+// ── Benchmarks ────────────────────────────────────────────────────────────────
+
+static void BM_Returns(benchmark::State& state, const char* mode, const char* function) {
+    sol::state lua;
+    open_state(lua);
+    lua.open_libraries(sol::lib::math);
+    register_usertypes(lua);
+    register_query_functions(lua);
+    lua.script(RETURN_SCRIPT);
+    lua["setup"](mode, state.range(0));
+    run_lua_function(state, lua, function);
+}
+BENCHMARK_CAPTURE(BM_Returns, optional_bound, "bound", "ray_hits")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Returns, optional_raw, "raw", "ray_hits")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Returns, variant_bound, "bound", "lookup")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Returns, variant_raw, "raw", "lookup")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Returns, tuple_bound, "bound", "center")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Returns, tuple_raw, "raw", "center")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Returns, vector_bound, "bound", "center_vector")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Returns, vector_raw, "raw", "center_vector")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Returns, optional_args_bound, "bound", "optional_args")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Returns, optional_args_raw, "raw", "optional_args")->Arg(1000)->Arg(10000);
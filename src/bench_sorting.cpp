@@ -0,0 +1,383 @@
+#include "bench_common.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+// ── Native sorting and searching ──────────────────────────────────────────────
+
+static float distance_sq(const Vector2& v, const Vector2& origin) {
+    float dx = v.x - origin.x, dy = v.y - origin.y;
+    return dx * dx + dy * dy;
+}
+
+static float distance_sq(const Point& p, const Point& origin) {
+    float dx = static_cast<float>(p.x - origin.x), dy = static_cast<float>(p.y - origin.y);
+    return dx * dx + dy * dy;
+}
+
+// (key, 1-based array index); the index breaks ties, so results are stable.
+using SortKey = std::pair<lua_Number, int>;
+
+// Sorts `keys` and permutes the Lua array at stack index 1 to match, following
+// cycles so every element is read and written once and the stack stays small
+// (Lua 5.1 caps C stack growth at 8000 slots).
+static void sort_array(lua_State* L, std::vector<SortKey>& keys) {
+    std::sort(keys.begin(), keys.end());
+    const int n = static_cast<int>(keys.size());
+    std::vector<bool> placed(n + 1);
+    for (int start = 1; start <= n; ++start) {
+        if (placed[start]) {
+            continue;
+        }
+        lua_rawgeti(L, 1, start); // held until the cycle closes
+        int slot = start;
+        for (;;) {
+            placed[slot] = true;
+            const int source = keys[slot - 1].second;
+            if (source == start) {
+                lua_rawseti(L, 1, slot);
+                break;
+            }
+            lua_rawgeti(L, 1, source);
+            lua_rawseti(L, 1, slot);
+            slot = source;
+        }
+    }
+}
+
+// sort_by_distance(array, origin): in place, nearest first. Each key is
+// computed once, unlike a comparator that recomputes both sides per compare.
+template <typename T>
+static int sort_by_distance(lua_State* L) {
+    const T& origin = sol::stack::get<T&>(L, 2);
+    const int n = static_cast<int>(lua_rawlen(L, 1));
+    std::vector<SortKey> keys(n);
+    for (int i = 1; i <= n; ++i) {
+        lua_rawgeti(L, 1, i);
+        keys[i - 1] = { distance_sq(sol::stack::get<T&>(L, -1), origin), i };
+        lua_pop(L, 1);
+    }
+    sort_array(L, keys);
+    return 0;
+}
+
+// sort_by_key(array, key_fn): in place by key_fn(element), called once per
+// element.
+static int sort_by_key(lua_State* L) {
+    const int n = static_cast<int>(lua_rawlen(L, 1));
+    std::vector<SortKey> keys(n);
+    for (int i = 1; i <= n; ++i) {
+        lua_pushvalue(L, 2);
+        lua_rawgeti(L, 1, i);
+        lua_call(L, 1, 1);
+        keys[i - 1] = { lua_tonumber(L, -1), i };
+        lua_pop(L, 1);
+    }
+    sort_array(L, keys);
+    return 0;
+}
+
+// lower_bound_by_distance(sorted, origin, r2): first index whose squared
+// distance is not below r2, or #sorted + 1.
+template <typename T>
+static int lower_bound_by_distance(lua_State* L) {
+    const T& origin = sol::stack::get<T&>(L, 2);
+    const lua_Number r2 = lua_tonumber(L, 3);
+    int lo = 1, hi = static_cast<int>(lua_rawlen(L, 1)) + 1;
+    while (lo < hi) {
+        const int mid = lo + (hi - lo) / 2;
+        lua_rawgeti(L, 1, mid);
+        const bool below = distance_sq(sol::stack::get<T&>(L, -1), origin) < r2;
+        lua_pop(L, 1);
+        if (below) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    lua_pushinteger(L, lo);
+    return 1;
+}
+
+// nearest(array, origin, k): new array of the k nearest elements, nearest first.
+template <typename T>
+static int nearest(lua_State* L) {
+    const T& origin = sol::stack::get<T&>(L, 2);
+    const int n = static_cast<int>(lua_rawlen(L, 1));
+    const int k = std::min(n, static_cast<int>(lua_tointeger(L, 3)));
+    std::vector<SortKey> keys(n);
+    for (int i = 1; i <= n; ++i) {
+        lua_rawgeti(L, 1, i);
+        keys[i - 1] = { distance_sq(sol::stack::get<T&>(L, -1), origin), i };
+        lua_pop(L, 1);
+    }
+    std::partial_sort(keys.begin(), keys.begin() + k, keys.end());
+    lua_createtable(L, k, 0);
+    for (int j = 0; j < k; ++j) {
+        lua_rawgeti(L, 1, keys[j].second);
+        lua_rawseti(L, -2, j + 1);
+    }
+    return 1;
+}
+
+// The same operations on a std::vector sol2 exposes as a container userdata,
+// so elements never leave C++ while sorting.
+using Vector2List = std::vector<Vector2>;
+
+static Vector2List to_list(sol::table array) {
+    Vector2List list;
+    list.reserve(array.size());
+    for (std::size_t i = 1; i <= array.size(); ++i) {
+        list.push_back(array.raw_get<Vector2>(i));
+    }
+    return list;
+}
+
+static Vector2List sorted_list(const Vector2List& list, const Vector2& origin) {
+    Vector2List sorted = list;
+    std::sort(sorted.begin(), sorted.end(), [&](const Vector2& a, const Vector2& b) {
+        return distance_sq(a, origin) < distance_sq(b, origin);
+    });
+    return sorted;
+}
+
+static int lower_bound_in_list(const Vector2List& sorted, const Vector2& origin, float r2) {
+    auto it = std::lower_bound(sorted.begin(), sorted.end(), r2, [&](const Vector2& v, float r) {
+        return distance_sq(v, origin) < r;
+    });
+    return static_cast<int>(it - sorted.begin()) + 1;
+}
+
+static Vector2List nearest_in_list(const Vector2List& list, const Vector2& origin, int k) {
+    Vector2List out(static_cast<std::size_t>(std::min<std::size_t>(k, list.size())));
+    std::partial_sort_copy(list.begin(), list.end(), out.begin(), out.end(), [&](const Vector2& a, const Vector2& b) {
+        return distance_sq(a, origin) < distance_sq(b, origin);
+    });
+    return out;
+}
+
+static void register_sort_functions(sol::state& lua) {
+    lua.create_named_table("geo",
+        "sort_by_distance",        &sort_by_distance<Vector2>,
+        "sort_points_by_distance", &sort_by_distance<Point>,
+        "sort_by_key",             &sort_by_key,
+        "lower_bound_by_distance", &lower_bound_by_distance<Vector2>,
+        "nearest",                 &nearest<Vector2>,
+        "to_list",                 &to_list,
+        "sorted_list",             &sorted_list,
+        "lower_bound_in_list",     &lower_bound_in_list,
+        "nearest_in_list",         &nearest_in_list);
+}
+
+// ── Lua scripts ───────────────────────────────────────────────────────────────
+
+// setup(n) builds n random Vector2 and Point around the origin, a sorted copy
+// of the vectors and the matching Vector2List containers. Distances are from
+// the origin because that is the only order __lt can express. Sort workloads
+// copy the unsorted array first and count one item per element; search
+// workloads run n queries; top-k workloads pick the K nearest of n.
+static constexpr const char* SORT_SCRIPT = R"lua(
+local K = 10
+
+-- Park-Miller: exact in 64-bit integers and in doubles, so every Lua version
+-- sees the same input. Not in LUA_32BITS builds (LUATYPETEST_LUA_32BITS),
+-- where seed * 16807 overflows the 32-bit integer or float and the sequence
+-- diverges; compare those only with each other.
+local seed = 1
+local function rand(m)
+    seed = (seed * 16807) % 2147483647
+    return seed % m
+end
+
+local origin, point_origin
+local vectors, points, sorted, queries
+local list, sorted_list
+
+local function copy(src, n)
+    local a = {}
+    for i = 1, n do a[i] = src[i] end
+    return a
+end
+
+function setup(n)
+    seed = 1
+    vectors, points, queries = {}, {}, {}
+    for i = 1, n do
+        vectors[i] = Vector2(rand(1000) - 500, rand(1000) - 500)
+        points[i] = Point(rand(1000) - 500, rand(1000) - 500)
+        queries[i] = rand(500000)
+    end
+    origin, point_origin = Vector2(0, 0), Point(0, 0)
+    sorted = copy(vectors, n)
+    geo.sort_by_distance(sorted, origin)
+    list = geo.to_list(vectors)
+    sorted_list = geo.sorted_list(list, origin)
+end
+
+local function by_distance(a, b)
+    return a.x*a.x + a.y*a.y < b.x*b.x + b.y*b.y
+end
+
+local function by_x(a, b) return a.x < b.x end
+local function key_x(v) return v.x end
+
+-- Sort
+
+function sort_comparator(n)
+    local a = copy(vectors, n)
+    table.sort(a, by_distance)
+    return a[1].x
+end
+
+function sort_lt(n)
+    local a = copy(vectors, n)
+    table.sort(a)
+    return a[1].x
+end
+
+function sort_cxx(n)
+    local a = copy(vectors, n)
+    geo.sort_by_distance(a, origin)
+    return a[1].x
+end
+
+function sort_key_comparator(n)
+    local a = copy(vectors, n)
+    table.sort(a, by_x)
+    return a[1].x
+end
+
+function sort_key_cxx(n)
+    local a = copy(vectors, n)
+    geo.sort_by_key(a, key_x)
+    return a[1].x
+end
+
+function sort_container(n)
+    local s = geo.sorted_list(list, origin)
+    return s[1].x
+end
+
+function sort_points_comparator(n)
+    local a = copy(points, n)
+    table.sort(a, by_distance)
+    return a[1].x
+end
+
+function sort_points_cxx(n)
+    local a = copy(points, n)
+    geo.sort_points_by_distance(a, point_origin)
+    return a[1].x
+end
+
+-- Binary search: index of the first element at or beyond each query radius
+
+function search_lua(n)
+    local floor = math.floor
+    local sum = 0
+    for i = 1, n do
+        local r2 = queries[i]
+        local lo, hi = 1, n + 1
+        while lo < hi do
+            local mid = floor((lo + hi) / 2)
+            local v = sorted[mid]
+            if v.x*v.x + v.y*v.y < r2 then lo = mid + 1 else hi = mid end
+        end
+        sum = sum + lo
+    end
+    return sum
+end
+
+function search_cxx(n)
+    local sum = 0
+    local lower_bound = geo.lower_bound_by_distance
+    for i = 1, n do
+        sum = sum + lower_bound(sorted, origin, queries[i])
+    end
+    return sum
+end
+
+function search_container(n)
+    local sum = 0
+    local lower_bound = geo.lower_bound_in_list
+    for i = 1, n do
+        sum = sum + lower_bound(sorted_list, origin, queries[i])
+    end
+    return sum
+end
+
+-- Top-k nearest
+
+function topk_sort(n)
+    local a = copy(vectors, n)
+    table.sort(a, by_distance)
+    local sum = 0
+    for j = 1, K do sum = sum + a[j].x end
+    return sum
+end
+
+-- One pass keeping the K best in an insertion-sorted array
+function topk_insertion(n)
+    local best, dist, count = {}, {}, 0
+    for i = 1, n do
+        local v = vectors[i]
+        local d = v.x*v.x + v.y*v.y
+        if count < K or d < dist[count] then
+            if count < K then count = count + 1 end
+            local j = count
+            while j > 1 and dist[j - 1] > d do
+                best[j], dist[j] = best[j - 1], dist[j - 1]
+                j = j - 1
+            end
+            best[j], dist[j] = v, d
+        end
+    end
+    local sum = 0
+    for j = 1, K do sum = sum + best[j].x end
+    return sum
+end
+
+function topk_cxx(n)
+    local best = geo.nearest(vectors, origin, K)
+    local sum = 0
+    for j = 1, K do sum = sum + best[j].x end
+    return sum
+end
+
+function topk_container(n)
+    local best = geo.nearest_in_list(list, origin, K)
+    local sum = 0
+    for j = 1, K do sum = sum + best[j].x end
+    return sum
+end
+)lua";
+
+// ── Benchmarks ────────────────────────────────────────────────────────────────
+
+static void BM_Sort(benchmark::State& state, const char* function) {
+    sol::state lua;
+    open_state(lua);
+    lua.open_libraries(sol::lib::math, sol::lib::table);
+    register_usertypes(lua);
+    register_metamethods(lua);
+    register_sort_functions(lua);
+    lua.script(SORT_SCRIPT);
+    lua["setup"](state.range(0));
+    run_lua_function(state, lua, function);
+}
+BENCHMARK_CAPTURE(BM_Sort, comparator, "sort_comparator")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Sort, lt_metamethod, "sort_lt")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Sort, cxx, "sort_cxx")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Sort, key_comparator, "sort_key_comparator")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Sort, key_cxx, "sort_key_cxx")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Sort, container, "sort_container")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Sort, points_comparator, "sort_points_comparator")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Sort, points_cxx, "sort_points_cxx")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Sort, search_lua, "search_lua")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Sort, search_cxx, "search_cxx")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Sort, search_container, "search_container")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Sort, topk_sort, "topk_sort")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Sort, topk_insertion, "topk_insertion")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Sort, topk_cxx, "topk_cxx")->Arg(1000)->Arg(10000);
+BENCHMARK_CAPTURE(BM_Sort, topk_container, "topk_container")->Arg(1000)->Arg(10000);
@@ -0,0 +1,173 @@
+#include "bench_common.hpp"
+
+#include <string>
+#include <string_view>
+
+// ── Bindings ──────────────────────────────────────────────────────────────────
+
+// All three expose label(), set_label(s) and has_label(s) as methods, so the
+// dispatch is the same and only the string handling differs.
+enum class LabelBinding {
+    copy,   // std::string in and out: every read, write and compare converts
+    view,   // std::string_view in and out: no std::string on the Lua side
+    cached, // the Lua string kept in the userdata's user value (Lua 5.3+)
+};
+
+#if LUA_VERSION_NUM >= 503
+#if LUA_VERSION_NUM >= 504
+static void get_cached_label(lua_State* L, int index) { lua_getiuservalue(L, index, 1); }
+static void set_cached_label(lua_State* L, int index) { lua_setiuservalue(L, index, 1); }
+#else
+static void get_cached_label(lua_State* L, int index) { lua_getuservalue(L, index); }
+static void set_cached_label(lua_State* L, int index) { lua_setuservalue(L, index); }
+#endif
+
+// Pushes the cached label of the NamedRectF at index 1, creating it from the
+// std::string on first use.
+static void push_cached_label(lua_State* L) {
+    get_cached_label(L, 1);
+    if (lua_isnil(L, -1)) {
+        lua_pop(L, 1);
+        const std::string& label = sol::stack::get<NamedRectF&>(L, 1).label;
+        lua_pushlstring(L, label.data(), label.size());
+        lua_pushvalue(L, -1);
+        set_cached_label(L, 1);
+    }
+}
+
+static int label_cached(lua_State* L) {
+    push_cached_label(L);
+    return 1;
+}
+
+// Keeps the std::string authoritative for C++ and the Lua string for Lua
+static int set_label_cached(lua_State* L) {
+    std::size_t size;
+    const char* label = lua_tolstring(L, 2, &size);
+    sol::stack::get<NamedRectF&>(L, 1).label.assign(label, size);
+    lua_pushvalue(L, 2);
+    set_cached_label(L, 1);
+    return 0;
+}
+
+// Interned strings compare by pointer; longer ones fall back to memcmp
+static int has_label_cached(lua_State* L) {
+    push_cached_label(L);
+    lua_pushboolean(L, lua_rawequal(L, -1, 2));
+    return 1;
+}
+#endif
+
+static void register_named_rect(sol::state& lua, LabelBinding binding) {
+    switch (binding) {
+    case LabelBinding::copy:
+        lua.new_usertype<NamedRectF>("NamedRectF",
+            sol::call_constructor, sol::constructors<NamedRectF(float, float, float, float, std::string)>(),
+            "label",     [](const NamedRectF& r) { return r.label; },
+            "set_label", [](NamedRectF& r, std::string label) { r.label = std::move(label); },
+            "has_label", [](const NamedRectF& r, const std::string& label) { return r.label == label; });
+        break;
+    case LabelBinding::view:
+        lua.new_usertype<NamedRectF>("NamedRectF",
+            sol::call_constructor, sol::constructors<NamedRectF(float, float, float, float, std::string)>(),
+            "label",     &NamedRectF::name,
+            "set_label", [](NamedRectF& r, std::string_view label) { r.label.assign(label.data(), label.size()); },
+            "has_label", [](const NamedRectF& r, std::string_view label) { return r.name() == label; });
+        break;
+    case LabelBinding::cached:
+#if LUA_VERSION_NUM >= 503
+        lua.new_usertype<NamedRectF>("NamedRectF",
+            sol::call_constructor, sol::constructors<NamedRectF(float, float, float, float, std::string)>(),
+            "label",     &label_cached,
+            "set_label", &set_label_cached,
+            "has_label", &has_label_cached);
+#endif
+        break;
+    }
+}
+
+// ── Lua scripts ───────────────────────────────────────────────────────────────
+
+// n persistent rects cycling through 16 labels of 24 characters: longer than
+// any std::string small-buffer, short enough for Lua to intern.
+static constexpr const char* STRING_SCRIPT = R"lua(
+local names, rects = {}, {}
+for i = 1, 16 do
+    names[i] = string.format("ui.panel.button.%02d.label", i)
+end
+local target = names[1]
+
+function setup(n)
+    rects = {}
+    for i = 1, n do
+        rects[i] = NamedRectF(i, 0, 10, 5, names[i % 16 + 1])
+    end
+end
+
+function read(n)
+    local total = 0
+    for i = 1, n do
+        total = total + #rects[i]:label()
+    end
+    return total
+end
+
+-- C++ compares the label against a Lua string argument
+function compare_cxx(n)
+    local count = 0
+    for i = 1, n do
+        if rects[i]:has_label(target) then count = count + 1 end
+    end
+    return count
+end
+
+-- Lua compares the returned label
+function compare_lua(n)
+    local count = 0
+    for i = 1, n do
+        if rects[i]:label() == target then count = count + 1 end
+    end
+    return count
+end
+
+-- Relabel, then read back
+function write(n)
+    local total = 0
+    for i = 1, n do
+        local r = rects[i]
+        r:set_label(names[(i + 7) % 16 + 1])
+        total = total + #r:label()
+    end
+    return total
+end
+)lua";
+
+// ── Benchmarks ────────────────────────────────────────────────────────────────
+
+static void BM_Strings(benchmark::State& state, LabelBinding binding, const char* function) {
+    sol::state lua;
+    open_state(lua);
+    lua.open_libraries(sol::lib::string);
+    register_named_rect(lua, binding);
+    lua.script(STRING_SCRIPT);
+    lua["setup"](state.range(0));
+    run_lua_function(state, lua, function);
+}
+
+#define STRING_BENCHMARK(name, binding, function) \
+    BENCHMARK_CAPTURE(BM_Strings, name, LabelBinding::binding, function)->Arg(1000)->Arg(10000)
+
+STRING_BENCHMARK(read_copy,          copy,   "read");
+STRING_BENCHMARK(read_view,          view,   "read");
+STRING_BENCHMARK(compare_cxx_copy,   copy,   "compare_cxx");
+STRING_BENCHMARK(compare_cxx_view,   view,   "compare_cxx");
+STRING_BENCHMARK(compare_lua_copy,   copy,   "compare_lua");
+STRING_BENCHMARK(compare_lua_view,   view,   "compare_lua");
+STRING_BENCHMARK(write_copy,         copy,   "write");
+STRING_BENCHMARK(write_view,         view,   "write");
+#if LUA_VERSION_NUM >= 503
+STRING_BENCHMARK(read_cached,        cached, "read");
+STRING_BENCHMARK(compare_cxx_cached, cached, "compare_cxx");
+STRING_BENCHMARK(compare_lua_cached, cached, "compare_lua");
+STRING_BENCHMARK(write_cached,       cached, "write");
+#endif
@@ -0,0 +1,173 @@
+#include "bench_common.hpp"
+#include "user_values.hpp"
+
+// Per-object data attached from Lua: in the object's own user-value slots, or
+// in weak-keyed side tables indexed by the object. Lua 5.4+ only; older
+// versions have at most one user value per userdata.
+#if LUA_VERSION_NUM >= 504
+
+// ── Bindings ──────────────────────────────────────────────────────────────────
+
+// make_vector2(x, y): a Vector2 with the slot count in upvalue 1. The side
+// table benchmarks use 0 slots, so every mode allocates the same way.
+static int make_vector2(lua_State* L) {
+    const auto x = static_cast<float>(luaL_checknumber(L, 1));
+    const auto y = static_cast<float>(luaL_checknumber(L, 2));
+    push_with_user_values(L, Vector2{ x, y }, static_cast<int>(lua_tointeger(L, lua_upvalueindex(1))));
+    return 1;
+}
+
+static void register_user_value_types(sol::state& lua, int slots) {
+    register_usertypes(lua);
+    register_vector_methods(lua);
+    register_user_value_functions<Vector2>(lua, "Vector2");
+    lua_State* L = lua.lua_state();
+    lua_pushinteger(L, slots);
+    lua_pushcclosure(L, &make_vector2, 1);
+    lua_setglobal(L, "make_vector2");
+}
+
+// ── Lua scripts ───────────────────────────────────────────────────────────────
+
+// setup(n) builds n tagged vectors. Slot 1 holds the tag and slot 2 the
+// memoised length; the side tables hold the same data, keyed by the object.
+static constexpr const char* USER_VALUE_SCRIPT = R"lua(
+local get, set = user_value, set_user_value
+local objects
+local tags, lengths
+
+function setup(n, slots)
+    tags = setmetatable({}, { __mode = "k" })
+    lengths = setmetatable({}, { __mode = "k" })
+    objects = {}
+    for i = 1, n do
+        local v = make_vector2(i, -i)
+        if slots > 0 then set(v, 1, i) else tags[v] = i end
+        objects[i] = v
+    end
+end
+
+-- Read the tag
+
+function read_slot(n)
+    local sum = 0
+    for i = 1, n do
+        sum = sum + get(objects[i], 1)
+    end
+    return sum
+end
+
+function read_slot_method(n)
+    local sum = 0
+    for i = 1, n do
+        sum = sum + objects[i]:user_value(1)
+    end
+    return sum
+end
+
+function read_side(n)
+    local sum = 0
+    for i = 1, n do
+        sum = sum + tags[objects[i]]
+    end
+    return sum
+end
+
+-- Overwrite the tag
+
+function write_slot(n)
+    for i = 1, n do
+        set(objects[i], 1, n - i)
+    end
+    return n
+end
+
+function write_side(n)
+    for i = 1, n do
+        tags[objects[i]] = n - i
+    end
+    return n
+end
+
+-- Length computed in C++ on first use, then served from the cache
+
+function memo_slot(n)
+    local sum = 0.0
+    for i = 1, n do
+        local v = objects[i]
+        local l = get(v, 2)
+        if l == nil then
+            l = v:length()
+            set(v, 2, l)
+        end
+        sum = sum + l
+    end
+    return sum
+end
+
+function memo_side(n)
+    local sum = 0.0
+    for i = 1, n do
+        local v = objects[i]
+        local l = lengths[v]
+        if l == nil then
+            l = v:length()
+            lengths[v] = l
+        end
+        sum = sum + l
+    end
+    return sum
+end
+
+-- n new tagged objects per call, replacing the previous batch, which the
+-- collector then frees (and, for side tables, clears from the weak table)
+
+function create_slot(n)
+    local batch = {}
+    for i = 1, n do
+        local v = make_vector2(i, -i)
+        set(v, 1, i)
+        batch[i] = v
+    end
+    objects = batch
+    return n
+end
+
+function create_side(n)
+    local batch = {}
+    for i = 1, n do
+        local v = make_vector2(i, -i)
+        tags[v] = i
+        batch[i] = v
+    end
+    objects = batch
+    return n
+end
+)lua";
+
+// ── Benchmarks ────────────────────────────────────────────────────────────────
+
+static void BM_UserValues(benchmark::State& state, int slots, const char* function) {
+    sol::state lua;
+    open_state(lua);
+    register_user_value_types(lua, slots);
+    lua.script(USER_VALUE_SCRIPT);
+    lua["setup"](state.range(0), slots);
+    run_lua_function(state, lua, function);
+}
+
+#define USER_VALUE_BENCHMARK(name, slots, function) \
+    BENCHMARK_CAPTURE(BM_UserValues, name, slots, function)->Arg(1000)->Arg(10000)
+
+USER_VALUE_BENCHMARK(read_slot,        2, "read_slot");
+USER_VALUE_BENCHMARK(read_slot_method, 2, "read_slot_method");
+USER_VALUE_BENCHMARK(read_side,        0, "read_side");
+USER_VALUE_BENCHMARK(write_slot,       2, "write_slot");
+USER_VALUE_BENCHMARK(write_side,       0, "write_side");
+USER_VALUE_BENCHMARK(memo_slot,        2, "memo_slot");
+USER_VALUE_BENCHMARK(memo_side,        0, "memo_side");
+USER_VALUE_BENCHMARK(create_slot_2,    2, "create_slot");
+USER_VALUE_BENCHMARK(create_slot_8,    8, "create_slot");
+USER_VALUE_BENCHMARK(create_side,      0, "create_side");
+
+#endif
@@ -0,0 +1,151 @@
+#include "bench_common.hpp"
+
+// ── Lua scripts ───────────────────────────────────────────────────────────────
+
+// Memoisation caches for Vector2 userdata or {x, y} tables; the cached value
+// is the object's normalised vector. setup(kind, mode, n, gc) builds n live
+// objects, each with a cache entry, in one of four caches:
+//   strong:    cache[obj] = unit, a plain table (the baseline; never shrinks)
+//   keys:      the same with __mode = "k"
+//   values:    cache[k] = unit with __mode = "v" and k a fresh counter value,
+//              so churn adds entries rather than overwriting live ones;
+//              setup keeps its units alive
+//   ephemeron: cache[obj] = { source = obj, unit = unit } with __mode = "k".
+//              The value refers to its key, which only an ephemeron table
+//              (Lua 5.2+) can still collect
+// gc is "incremental" or "generational" (Lua 5.4).
+static constexpr const char* WEAK_CACHE_SCRIPT = R"lua(
+local sqrt = math.sqrt
+local make, unit, memoise, new_cache
+local cache, keys, held, objects
+local next_key = 0
+
+local makers = {
+    userdata = {
+        make = function(x, y) return Vector2(x, y) end,
+        unit = function(v) return v:normalize() end,
+    },
+    table = {
+        make = function(x, y) return { x = x, y = y } end,
+        unit = function(v)
+            local l = sqrt(v.x * v.x + v.y * v.y)
+            return { x = v.x / l, y = v.y / l }
+        end,
+    },
+}
+
+-- Each memoise(i, obj) caches obj's unit vector and returns the entry's key
+-- and the cached value
+local caches = {
+    strong = {
+        new = function() return {} end,
+        memoise = function(i, o) local u = unit(o) cache[o] = u return o, u end,
+    },
+    keys = {
+        new = function() return setmetatable({}, { __mode = "k" }) end,
+        memoise = function(i, o) local u = unit(o) cache[o] = u return o, u end,
+    },
+    values = {
+        new = function() return setmetatable({}, { __mode = "v" }) end,
+        memoise = function(i, o)
+            next_key = next_key + 1
+            local u = unit(o)
+            cache[next_key] = u
+            return next_key, u
+        end,
+    },
+    ephemeron = {
+        new = function() return setmetatable({}, { __mode = "k" }) end,
+        memoise = function(i, o) local e = { source = o, unit = unit(o) } cache[o] = e return o, e end,
+    },
+}
+
+function setup(kind, mode, n, gc)
+    if gc == "generational" then collectgarbage("generational") end
+    make, unit = makers[kind].make, makers[kind].unit
+    new_cache, memoise = caches[mode].new, caches[mode].memoise
+    cache = new_cache()
+    next_key = 0
+    objects, keys, held = {}, {}, {}
+    for i = 1, n do
+        local o = make(i, i + 1)
+        objects[i] = o
+        keys[i], held[i] = memoise(i, o)
+    end
+    collectgarbage("collect")
+end
+
+-- Cache hits on the n live entries
+function lookup(n)
+    local hits = 0
+    for i = 1, n do
+        if cache[keys[i]] ~= nil then hits = hits + 1 end
+    end
+    return hits
+end
+
+-- n new objects memoised and dropped; the collector runs as allocation drives
+-- it. The strong cache is replaced instead, as it would otherwise only grow.
+function churn(n)
+    if new_cache == caches.strong.new then cache = new_cache() end
+    for i = 1, n do
+        memoise(i, make(i, i + 1))
+    end
+    return n
+end
+
+-- churn, then a full collection that clears the dead entries
+function churn_collect(n)
+    churn(n)
+    collectgarbage("collect")
+    return n
+end
+
+-- A full collection with only the n live entries in the cache
+function collect_live(n)
+    collectgarbage("collect")
+    return n
+end
+)lua";
+
+// ── Benchmarks ────────────────────────────────────────────────────────────────
+
+static void BM_WeakCache(benchmark::State& state, const char* kind, const char* mode, const char* gc, const char* function) {
+    sol::state lua;
+    open_state(lua);
+    lua.open_libraries(sol::lib::math);
+    register_usertypes(lua);
+    register_vector_methods(lua);
+    lua.script(WEAK_CACHE_SCRIPT);
+    lua["setup"](kind, mode, state.range(0), gc);
+    run_lua_function(state, lua, function);
+}
+
+#define WEAK_CACHE_BENCHMARK(name, kind, mode, gc, function) \
+    BENCHMARK_CAPTURE(BM_WeakCache, name, kind, mode, gc, function)->Arg(1000)->Arg(100000)
+
+// Every workload for one cache mode and collector mode, over both kinds
+#define WEAK_CACHE_BENCHMARKS(mode, suffix, gc)                                                            \
+    WEAK_CACHE_BENCHMARK(lookup_##mode##_userdata##suffix,        "userdata", #mode, gc, "lookup");        \
+    WEAK_CACHE_BENCHMARK(lookup_##mode##_table##suffix,           "table",    #mode, gc, "lookup");        \
+    WEAK_CACHE_BENCHMARK(churn_##mode##_userdata##suffix,         "userdata", #mode, gc, "churn");         \
+    WEAK_CACHE_BENCHMARK(churn_##mode##_table##suffix,            "table",    #mode, gc, "churn");         \
+    WEAK_CACHE_BENCHMARK(churn_collect_##mode##_userdata##suffix, "userdata", #mode, gc, "churn_collect"); \
+    WEAK_CACHE_BENCHMARK(churn_collect_##mode##_table##suffix,    "table",    #mode, gc, "churn_collect"); \
+    WEAK_CACHE_BENCHMARK(collect_live_##mode##_userdata##suffix,  "userdata", #mode, gc, "collect_live");  \
+    WEAK_CACHE_BENCHMARK(collect_live_##mode##_table##suffix,     "table",    #mode, gc, "collect_live")
+
+WEAK_CACHE_BENCHMARKS(strong, , "incremental");
+WEAK_CACHE_BENCHMARKS(keys,   , "incremental");
+WEAK_CACHE_BENCHMARKS(values, , "incremental");
+// Lua 5.1 and LuaJIT never collect a weak-keyed entry whose value refers to
+// its key, so the ephemeron churn would only grow
+#if LUA_VERSION_NUM >= 502
+WEAK_CACHE_BENCHMARKS(ephemeron, , "incremental");
+#endif
+#if LUA_VERSION_NUM >= 504
+WEAK_CACHE_BENCHMARKS(strong,    _generational, "generational");
+WEAK_CACHE_BENCHMARKS(keys,      _generational, "generational");
+WEAK_CACHE_BENCHMARKS(values,    _generational, "generational");
+WEAK_CACHE_BENCHMARKS(ephemeron, _generational, "generational");
+#endif
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// ── Struct definitions ────────────────────────────────────────────────────────
+
+struct Vector2 {
+    float x, y;
+    Vector2() : x(0), y(0) {}
+    explicit Vector2(float s) : x(s), y(s) {}
+    Vector2(float x, float y) : x(x), y(y) {}
+
+    float dot(const Vector2& o) const      { return x * o.x + y * o.y; }
+    float cross(const Vector2& o) const    { return x * o.y - y * o.x; }
+    float length_sq() const                { return dot(*this); }
+    float length() const                   { return std::sqrt(length_sq()); }
+    Vector2 normalize() const              { float l = length(); return Vector2{ x / l, y / l }; }
+    Vector2 lerp(const Vector2& o, float t) const { return Vector2{ x + (o.x - x) * t, y + (o.y - y) * t }; }
+    float distance(const Vector2& o) const { return Vector2{ x - o.x, y - o.y }.length(); }
+};
+struct Vector3 {
+    float x, y, z;
+    Vector3() : x(0), y(0), z(0) {}
+    explicit Vector3(float s) : x(s), y(s), z(s) {}
+    Vector3(float x, float y, float z) : x(x), y(y), z(z) {}
+
+    float dot(const Vector3& o) const      { return x * o.x + y * o.y + z * o.z; }
+    Vector3 cross(const Vector3& o) const  { return Vector3{ y * o.z - z * o.y, z * o.x - x * o.z, x * o.y - y * o.x }; }
+    float length_sq() const                { return dot(*this); }
+    float length() const                   { return std::sqrt(length_sq()); }
+    Vector3 normalize() const              { float l = length(); return Vector3{ x / l, y / l, z / l }; }
+    Vector3 lerp(const Vector3& o, float t) const { return Vector3{ x + (o.x - x) * t, y + (o.y - y) * t, z + (o.z - z) * t }; }
+    float distance(const Vector3& o) const { return Vector3{ x - o.x, y - o.y, z - o.z }.length(); }
+};
+// Row-major; vectors are row vectors (v * M)
+struct Mat2 {
+    float m[2][2];
+    Mat2(float a, float b, float c, float d) : m{ { a, b }, { c, d } } {}
+};
+struct Mat3 {
+    float m[3][3];
+    Mat3(float a, float b, float c, float d, float e, float f, float g, float h, float i)
+        : m{ { a, b, c }, { d, e, f }, { g, h, i } } {}
+};
+struct RectF {
+    float x, y, w, h;
+    RectF(float x, float y, float w, float h) : x(x), y(y), w(w), h(h) {}
+
+    float area() const { return w * h; }
+};
+// RectF composed of two Vector2; size.x is the width, size.y the height
+struct NestedRectF {
+    Vector2 pos, size;
+    NestedRectF(float x, float y, float w, float h) : pos(x, y), size(w, h) {}
+
+    float area() const { return size.x * size.y; }
+};
+struct Point {
+    int x, y;
+    Point(int x, int y) : x(x), y(y) {}
+};
+// RectF tagged with a UI label
+struct NamedRectF {
+    float x, y, w, h;
+    std::string label;
+    NamedRectF(float x, float y, float w, float h, std::string label)
+        : x(x), y(y), w(w), h(h), label(std::move(label)) {}
+
+    std::string_view name() const { return label; }
+};
+// Which point of a rect its position refers to
+enum class Anchor { top_left, top, top_right, left, center, right, bottom_left, bottom, bottom_right };
+// Collision layers; a point's flags combine any of them
+enum class Collision : unsigned { none = 0, world = 1, player = 2, enemy = 4, trigger = 8 };
+struct AnchoredRectF {
+    float x, y, w, h;
+    Anchor anchor;
+    AnchoredRectF(float x, float y, float w, float h, Anchor anchor) : x(x), y(y), w(w), h(h), anchor(anchor) {}
+};
+struct FlaggedPoint {
+    int x, y;
+    unsigned flags;
+    FlaggedPoint(int x, int y, unsigned flags) : x(x), y(y), flags(flags) {}
+
+    bool has_all(unsigned mask) const { return (flags & mask) == mask; }
+    bool has_any(unsigned mask) const { return (flags & mask) != 0; }
+};
+
+// Polymorphic hierarchy for the inheritance benchmark. RectF stays a plain
+// struct so the other benchmarks keep their layout; RectShape mirrors it.
+struct Shape {
+    float x, y;
+    Shape(float x, float y) : x(x), y(y) {}
+    virtual ~Shape() = default;
+
+    virtual float area() const = 0;
+    virtual bool contains(float px, float py) const = 0;
+    void move_by(float dx, float dy) { x += dx; y += dy; }
+};
+struct RectShape final : Shape {
+    float w, h;
+    RectShape(float x, float y, float w, float h) : Shape(x, y), w(w), h(h) {}
+
+    float area() const override { return w * h; }
+    bool contains(float px, float py) const override { return px >= x && px <= x + w && py >= y && py <= y + h; }
+};
+struct Circle final : Shape {
+    float r;
+    Circle(float x, float y, float r) : Shape(x, y), r(r) {}
+
+    float area() const override { return 3.14159265f * r * r; }
+    bool contains(float px, float py) const override { float dx = px - x, dy = py - y; return dx * dx + dy * dy <= r * r; }
+};
+
+// ── Multiplication ────────────────────────────────────────────────────────────
+
+inline Vector2 operator*(const Vector2& v, float s)          { return Vector2{ v.x * s, v.y * s }; }
+inline Vector2 operator*(float s, const Vector2& v)          { return Vector2{ s * v.x, s * v.y }; }
+inline Vector2 operator*(const Vector2& a, const Vector2& b) { return Vector2{ a.x * b.x, a.y * b.y }; }
+inline Vector2 operator*(const Vector2& v, const Mat2& m) {
+    return Vector2{ v.x * m.m[0][0] + v.y * m.m[1][0],
+                    v.x * m.m[0][1] + v.y * m.m[1][1] };
+}
+
+inline Vector3 operator*(const Vector3& v, float s)          { return Vector3{ v.x * s, v.y * s, v.z * s }; }
+inline Vector3 operator*(float s, const Vector3& v)          { return Vector3{ s * v.x, s * v.y, s * v.z }; }
+inline Vector3 operator*(const Vector3& a, const Vector3& b) { return Vector3{ a.x * b.x, a.y * b.y, a.z * b.z }; }
+inline Vector3 operator*(const Vector3& v, const Mat3& m) {
+    return Vector3{ v.x * m.m[0][0] + v.y * m.m[1][0] + v.z * m.m[2][0],
+                    v.x * m.m[0][1] + v.y * m.m[1][1] + v.z * m.m[2][1],
+                    v.x * m.m[0][2] + v.y * m.m[1][2] + v.z * m.m[2][2] };
+}
+
+// ── Equality and string conversion ────────────────────────────────────────────
+// Ordering and negation are Lua-facing only (vectors by length, rects by area,
+// points lexicographically) and are bound as metamethods in register_usertypes.
+
+inline bool operator==(const Vector2& a, const Vector2& b) { return a.x == b.x && a.y == b.y; }
+inline bool operator==(const Vector3& a, const Vector3& b) { return a.x == b.x && a.y == b.y && a.z == b.z; }
+inline bool operator==(const RectF& a, const RectF& b)     { return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h; }
+inline bool operator==(const Point& a, const Point& b)     { return a.x == b.x && a.y == b.y; }
+
+inline std::string to_string(const Vector2& v) {
+    char buf[64];
+    std::snprintf(buf, sizeof buf, "Vector2(%g, %g)", v.x, v.y);
+    return buf;
+}
+inline std::string to_string(const Vector3& v) {
+    char buf[96];
+    std::snprintf(buf, sizeof buf, "Vector3(%g, %g, %g)", v.x, v.y, v.z);
+    return buf;
+}
+inline std::string to_string(const RectF& r) {
+    char buf[128];
+    std::snprintf(buf, sizeof buf, "RectF(%g, %g, %g, %g)", r.x, r.y, r.w, r.h);
+    return buf;
+}
+inline std::string to_string(const Point& p) {
+    char buf[64];
+    std::snprintf(buf, sizeof buf, "Point(%d, %d)", p.x, p.y);
+    return buf;
+}
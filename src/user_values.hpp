@@ -0,0 +1,84 @@
+#pragma once
+
+#include <sol/sol.hpp>
+
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+// User-value slots for usertypes (Lua 5.4+). sol2 allocates every usertype
+// with Lua's default single user value; push_with_user_values allocates the
+// object itself with as many as asked for, so scripts can attach per-object
+// data (tags, memoised properties) without a side table keyed by the object.
+//
+// Only objects pushed through push_with_user_values have the extra slots.
+// Objects sol2 creates itself, such as the result of `v + w` or a T returned
+// from a bound C++ function, keep Lua's default and set_user_value fails on
+// any slot past it.
+#if LUA_VERSION_NUM >= 504
+
+// Pushes a copy of `value` in a userdata with `slots` user values, carrying the
+// T* metatable so every binding of T works on it. sol2 has no allocation hook
+// for this, so the block mimics its T* userdata: the pointer first, at the
+// start of Lua's maximally aligned block. check_user_value_layout verifies
+// that sol2 still reads it that way. The copy lives in the same block; T must
+// not need a destructor, since the T* metatable has no __gc.
+template <typename T>
+T& push_with_user_values(lua_State* L, const T& value, int slots) {
+    static_assert(std::is_trivially_destructible_v<T>, "user-value objects are never destroyed");
+    struct Block {
+        T* self;
+        T value;
+    };
+    static_assert(offsetof(Block, self) == 0, "sol2 reads the T* from the start of the userdata");
+    static_assert(alignof(Block) <= alignof(std::max_align_t), "Lua only guarantees maximal fundamental alignment");
+    Block* block = new (lua_newuserdatauv(L, sizeof(Block), slots)) Block{ nullptr, value };
+    block->self = &block->value;
+    luaL_setmetatable(L, sol::usertype_traits<T*>::metatable().c_str());
+    return block->value;
+}
+
+// Throws if sol2 no longer resolves a push_with_user_values object to the T in
+// its block, i.e. if its T* userdata layout or metatable naming changed
+template <typename T>
+void check_user_value_layout(lua_State* L) {
+    T& pushed = push_with_user_values(L, T{}, 1);
+    const bool same = sol::stack::check<T>(L, -1, sol::no_panic) && &sol::stack::get<T&>(L, -1) == &pushed;
+    lua_pop(L, 1);
+    if (!same) {
+        throw std::logic_error("push_with_user_values no longer matches sol2's T* userdata");
+    }
+}
+
+// user_value(obj, i): the value in slot i, nil if unset or out of range
+inline int user_value_slot_get(lua_State* L) {
+    luaL_checktype(L, 1, LUA_TUSERDATA);
+    lua_getiuservalue(L, 1, static_cast<int>(luaL_checkinteger(L, 2)));
+    return 1;
+}
+
+// set_user_value(obj, i, v): stores v in slot i; an error if there is none
+inline int user_value_slot_set(lua_State* L) {
+    luaL_checktype(L, 1, LUA_TUSERDATA);
+    const int slot = static_cast<int>(luaL_checkinteger(L, 2));
+    lua_settop(L, 3);
+    if (!lua_setiuservalue(L, 1, slot)) {
+        return luaL_error(L, "object has no user value %d", slot);
+    }
+    return 0;
+}
+
+// Registers user_value and set_user_value as globals and as methods of the
+// usertype T, already registered under `name`, after checking the layout
+template <typename T>
+void register_user_value_functions(sol::state& lua, const char* name) {
+    check_user_value_layout<T>(lua.lua_state());
+    lua.set_function("user_value", &user_value_slot_get);
+    lua.set_function("set_user_value", &user_value_slot_set);
+    sol::usertype<T> type = lua[name];
+    type["user_value"] = &user_value_slot_get;
+    type["set_user_value"] = &user_value_slot_set;
+}
+
+#endif
@@ -0,0 +1,11 @@
+# x64-linux with LTO bytecode in the static libraries, so Lua can be inlined
+# into the benchmark across the Lua/C++ boundary. Used by the linux-gcc-lto preset.
+set(VCPKG_TARGET_ARCHITECTURE x64)
+set(VCPKG_CRT_LINKAGE dynamic)
+set(VCPKG_LIBRARY_LINKAGE static)
+set(VCPKG_CMAKE_SYSTEM_NAME Linux)
+
+set(VCPKG_ENV_PASSTHROUGH CC CXX)
+set(VCPKG_C_FLAGS "-flto=auto -ffat-lto-objects")
+set(VCPKG_CXX_FLAGS "-flto=auto -ffat-lto-objects")
+set(VCPKG_CMAKE_CONFIGURE_OPTIONS -DCMAKE_AR=gcc-ar -DCMAKE_RANLIB=gcc-ranlib)